@@ -0,0 +1,72 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <opendnp3/logging/BinaryLogReader.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using namespace opendnp3;
+
+// prints a binary log written by AsyncLogger as text
+// usage: logdecoder [--location] <file>, reads stdin if no file is given
+int main(int argc, char* argv[])
+{
+    bool printLocation = false;
+    const char* path = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--location") == 0)
+        {
+            printLocation = true;
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+
+    std::ifstream file;
+    if (path)
+    {
+        file.open(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            std::cerr << "unable to open: " << path << std::endl;
+            return 1;
+        }
+    }
+
+    BinaryLogReader reader(path ? static_cast<std::istream&>(file) : std::cin);
+    if (!reader.IsValid())
+    {
+        std::cerr << "not a binary log" << std::endl;
+        return 1;
+    }
+
+    LogRecord record;
+    while (reader.Read(record))
+    {
+        record.Print(std::cout, printLocation);
+    }
+
+    return 0;
+}
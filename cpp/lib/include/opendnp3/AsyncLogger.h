@@ -0,0 +1,101 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_ASYNCLOGGER_H
+#define OPENDNP3_ASYNCLOGGER_H
+
+#include "opendnp3/logging/ILogHandler.h"
+#include "opendnp3/util/TimeDuration.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <memory>
+#include <string>
+
+namespace opendnp3
+{
+
+class AsyncLoggerImpl;
+
+/**
+ * Settings for an AsyncLogger
+ */
+struct AsyncLoggerConfig
+{
+    /// number of records buffered for each thread that logs, rounded up to a power of two
+    uint32_t recordsPerThread = 1024;
+
+    /// how often the background thread writes out buffered records
+    TimeDuration flushPeriod = TimeDuration::Milliseconds(10);
+
+    /// include the source location of each log call in text output
+    bool printLocation = false;
+};
+
+/**
+ * LogHandler that moves formatting and output off of the logging threads
+ *
+ * Each thread that logs copies its messages into a fixed-size record of its own lock-free ring. A background
+ * thread drains the rings and writes either text lines to the console or a compact binary file that can be
+ * read back with BinaryLogReader. Nothing is allocated or locked on the logging path once a thread has logged
+ * its first message. When a ring is full the message is dropped and counted.
+ */
+class AsyncLogger final : public opendnp3::ILogHandler, private Uncopyable
+{
+
+public:
+    /**
+     * Create a logger that prints text lines to the console
+     */
+    static std::shared_ptr<AsyncLogger> Create(const AsyncLoggerConfig& config = AsyncLoggerConfig());
+
+    /**
+     * Create a logger that writes binary records to a file
+     *
+     * @throw std::runtime_error if the file cannot be opened
+     */
+    static std::shared_ptr<AsyncLogger> CreateBinary(const std::string& path,
+                                                     const AsyncLoggerConfig& config = AsyncLoggerConfig());
+
+    explicit AsyncLogger(std::unique_ptr<AsyncLoggerImpl> impl);
+
+    /// writes out any buffered records and stops the background thread
+    ~AsyncLogger();
+
+    void log(opendnp3::ModuleId module,
+             const char* id,
+             opendnp3::LogLevel level,
+             char const* location,
+             char const* message) final;
+
+    /// write out the records buffered so far and wait until they have been flushed
+    void Flush();
+
+    /// @return number of messages that have been written out
+    uint64_t NumLogged() const;
+
+    /// @return number of messages that were dropped because the ring of their thread was full
+    uint64_t NumDropped() const;
+
+private:
+    std::unique_ptr<AsyncLoggerImpl> impl;
+};
+
+} // namespace opendnp3
+
+#endif
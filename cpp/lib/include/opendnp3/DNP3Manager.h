@@ -25,6 +25,7 @@
 #include "opendnp3/channel/IChannel.h"
 #include "opendnp3/channel/IChannelListener.h"
 #include "opendnp3/channel/IListener.h"
+#include "opendnp3/channel/IOContextMode.h"
 #include "opendnp3/channel/IPEndpoint.h"
 #include "opendnp3/channel/SerialSettings.h"
 #include "opendnp3/channel/TLSConfig.h"
@@ -58,12 +59,15 @@ public:
      *	@param handler Callback interface for log messages
      *	@param onThreadStart Action to run when a thread pool thread starts
      *	@param onThreadExit Action to run just before a thread pool thread exits
+     *	@param contextMode Share one I/O queue between the threads, or give each thread its own queue and assign
+     *	       channels to the threads round robin
      */
     DNP3Manager(
         uint32_t concurrencyHint,
         std::shared_ptr<opendnp3::ILogHandler> handler = std::shared_ptr<opendnp3::ILogHandler>(),
         std::function<void(uint32_t)> onThreadStart = [](uint32_t) {},
-        std::function<void(uint32_t)> onThreadExit = [](uint32_t) {});
+        std::function<void(uint32_t)> onThreadExit = [](uint32_t) {},
+        IOContextMode contextMode = IOContextMode::Shared);
 
     ~DNP3Manager();
 
@@ -72,6 +72,17 @@ public:
      */
     virtual void Foreach(IVisitor<T>& visitor) const = 0;
 
+    /**
+     * Copy all the elements of the collection into an array that can hold at least Count() elements
+     *
+     * The default implementation visits the elements one at a time. Collections that decode their
+     * elements from a buffer override it to decode all of them w/o a virtual call per element.
+     */
+    virtual void CopyTo(T* dest) const
+    {
+        this->ForeachItem([&dest](const T& value) { *dest++ = value; });
+    }
+
     /**
         visit all of the elements of a collection
     */
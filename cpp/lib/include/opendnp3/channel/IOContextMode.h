@@ -17,23 +17,23 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#ifndef OPENDNP3_IOCONTEXTMODE_H
+#define OPENDNP3_IOCONTEXTMODE_H
 
-#ifndef OPENDNP3_TYPEDSTORAGE_H
-#define OPENDNP3_TYPEDSTORAGE_H
-
-#include "List.h"
-#include "TypedEventRecord.h"
+#include <cstdint>
 
 namespace opendnp3
 {
 
-template<class T> struct TypedStorage : private StaticOnly
+/**
+ * Describes how the threads of a DNP3Manager run the asynchronous I/O of its channels
+ */
+enum class IOContextMode : uint8_t
 {
-
-    static inline Node<TypedEventRecord<T>>* Retrieve(EventRecord& record)
-    {
-        return reinterpret_cast<Node<TypedEventRecord<T>>*>(record.storage_node);
-    }
+    /// every thread runs the handlers of every channel from a single shared queue
+    Shared = 0,
+    /// every thread runs its own queue, and each channel and its sessions stay on the thread they are assigned to
+    PerThread = 1
 };
 
 } // namespace opendnp3
@@ -41,6 +41,9 @@ struct LinkStatistics
             this->numBadFunctionCode += other.numBadFunctionCode;
             this->numBadFCV += other.numBadFCV;
             this->numBadFCB += other.numBadFCB;
+            this->numReads += other.numReads;
+            this->maxFramesPerRead
+                = (other.maxFramesPerRead > this->maxFramesPerRead) ? other.maxFramesPerRead : this->maxFramesPerRead;
         }
 
         /// Number of frames discarded due to header CRC errors
@@ -63,6 +66,12 @@ struct LinkStatistics
 
         /// number of frames w/ unexpected FCB bit set (malformed frame)
         size_t numBadFCB = 0;
+
+        /// number of channel reads that were parsed, numLinkFrameRx / numReads is the average frames per read
+        size_t numReads = 0;
+
+        /// largest number of complete frames parsed from a single read
+        size_t maxFramesPerRead = 0;
     };
 
     struct Channel
@@ -75,6 +84,9 @@ struct LinkStatistics
             this->numBytesRx += other.numBytesRx;
             this->numBytesTx += other.numBytesTx;
             this->numLinkFrameTx += other.numLinkFrameTx;
+            this->numPriorityTx += other.numPriorityTx;
+            this->maxTxQueueDepth
+                = (other.maxTxQueueDepth > this->maxTxQueueDepth) ? other.maxTxQueueDepth : this->maxTxQueueDepth;
         }
 
         /// The number of times the channel has successfully opened
@@ -94,6 +106,12 @@ struct LinkStatistics
 
         /// Number of frames transmitted
         size_t numLinkFrameTx = 0;
+
+        /// Number of secondary frames (ACK, LINK_STATUS, ...) sent ahead of queued primary frames
+        size_t numPriorityTx = 0;
+
+        /// largest number of transmissions queued on the channel at once, bounds the wait of any one frame
+        size_t maxTxQueueDepth = 0;
     };
 
     LinkStatistics() = default;
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_BINARYLOGREADER_H
+#define OPENDNP3_BINARYLOGREADER_H
+
+#include "opendnp3/logging/LogLevels.h"
+
+#include <cstdint>
+#include <istream>
+#include <string>
+
+namespace opendnp3
+{
+
+/**
+ * A log message read back from a binary log
+ */
+struct LogRecord
+{
+    /// milliseconds since the epoch of the system clock
+    int64_t timestamp = 0;
+    ModuleId module;
+    LogLevel level;
+    std::string id;
+    std::string location;
+    std::string message;
+
+    /// write the record as a text line in the format of ConsoleLogger
+    void Print(std::ostream& output, bool printLocation) const;
+};
+
+/**
+ * Reads the binary logs written by AsyncLogger
+ */
+class BinaryLogReader
+{
+
+public:
+    /// reads the file header from the input
+    explicit BinaryLogReader(std::istream& input);
+
+    /// @return true if the input starts with a supported binary log header
+    bool IsValid() const
+    {
+        return this->valid;
+    }
+
+    /// @return true if a record was read, false at the end of the log or when a record is truncated
+    bool Read(LogRecord& record);
+
+private:
+    std::istream& input;
+    bool valid = false;
+};
+
+} // namespace opendnp3
+
+#endif
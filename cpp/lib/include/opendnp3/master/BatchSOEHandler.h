@@ -0,0 +1,98 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_BATCHSOEHANDLER_H
+#define OPENDNP3_BATCHSOEHANDLER_H
+
+#include "opendnp3/master/ISOEHandler.h"
+#include "opendnp3/master/MeasurementBatch.h"
+
+#include <memory>
+
+namespace opendnp3
+{
+
+/**
+ * An ISOEHandler that receives the measurements of each object header as a MeasurementBatch
+ * of contiguous arrays instead of visiting them one value at a time.
+ *
+ * The handler decodes each header straight into arrays that it owns and reuses, growing them to fit the largest header
+ * it has seen. Objects that aren't measurements (octet strings, command events, etc) are still delivered through the
+ * ISOEHandler overloads, which derived classes must implement.
+ */
+class BatchSOEHandler : public ISOEHandler
+{
+
+public:
+    virtual void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<Binary>& values) = 0;
+    virtual void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<DoubleBitBinary>& values) = 0;
+    virtual void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<Analog>& values) = 0;
+    virtual void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<Counter>& values) = 0;
+    virtual void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<FrozenCounter>& values) = 0;
+    virtual void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<BinaryOutputStatus>& values) = 0;
+    virtual void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<AnalogOutputStatus>& values) = 0;
+
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) final;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) final;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) final;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) final;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) final;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) final;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) final;
+
+    using ISOEHandler::Process;
+
+private:
+    // an array that is reused from one header to the next, only ever growing
+    template<class T> class Column
+    {
+    public:
+        T* Reserve(size_t count)
+        {
+            if (count > this->capacity)
+            {
+                this->data.reset(new T[count]);
+                this->capacity = count;
+            }
+            return this->data.get();
+        }
+
+    private:
+        std::unique_ptr<T[]> data;
+        size_t capacity = 0;
+    };
+
+    template<class T>
+    void Deliver(const HeaderInfo& info,
+                 const ICollection<Indexed<T>>& values,
+                 Column<typename T::Type>& column);
+
+    Column<uint16_t> indices;
+    Column<uint8_t> flags;
+    Column<DNPTime> times;
+
+    Column<bool> bools;
+    Column<DoubleBit> doubleBits;
+    Column<double> doubles;
+    Column<uint32_t> counts;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -41,7 +41,8 @@ public:
           tsquality(TimestampQuality::INVALID),
           isEventVariation(false),
           flagsValid(false),
-          headerIndex(0)
+          headerIndex(0),
+          isUnchanged(false)
     {
     }
 
@@ -51,7 +52,8 @@ public:
           tsquality(tsquality_),
           isEventVariation(IsEvent(gv_)),
           flagsValid(HasFlags(gv_)),
-          headerIndex(headerIndex_)
+          headerIndex(headerIndex_),
+          isUnchanged(false)
     {
     }
 
@@ -67,6 +69,8 @@ public:
     bool flagsValid;
     /// The 0-based index of the header within the ASDU
     uint32_t headerIndex;
+    /// True if every value was already reported for its index with the same value and flags, see MeasurementCache
+    bool isUnchanged;
 };
 
 } // namespace opendnp3
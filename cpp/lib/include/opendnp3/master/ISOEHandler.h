@@ -39,6 +39,8 @@ namespace opendnp3
  * A call is made to the appropriate member method for every measurement value in an ASDU.
  * The HeaderInfo class provides information about the object header associated with the value.
  *
+ * Derive from BatchSOEHandler instead to receive the measurements of each header as contiguous arrays.
+ *
  */
 class ISOEHandler
 {
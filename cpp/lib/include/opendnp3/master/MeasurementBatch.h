@@ -0,0 +1,64 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_MEASUREMENTBATCH_H
+#define OPENDNP3_MEASUREMENTBATCH_H
+
+#include "opendnp3/app/DNPTime.h"
+#include "opendnp3/app/Flags.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * The measurements of a single object header as parallel arrays, one element per measurement.
+ *
+ * The arrays are owned by the handler that delivers the batch and are only valid for the duration of the callback.
+ * The times are null if the header doesn't carry any, i.e. the timestamp quality of the HeaderInfo is INVALID.
+ */
+template<class T> class MeasurementBatch
+{
+public:
+    typedef typename T::Type ValueType;
+
+    MeasurementBatch(
+        size_t count, const uint16_t* indices, const ValueType* values, const uint8_t* flags, const DNPTime* times)
+        : count(count), indices(indices), values(values), flags(flags), times(times)
+    {
+    }
+
+    // rebuild the measurement at a position in the batch
+    T Get(size_t i) const
+    {
+        return T(this->values[i], Flags(this->flags[i]), this->times ? this->times[i] : DNPTime());
+    }
+
+    const size_t count;
+    const uint16_t* const indices;
+    const ValueType* const values;
+    const uint8_t* const flags;
+    const DNPTime* const times;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_MEASUREMENTCACHE_H
+#define OPENDNP3_MEASUREMENTCACHE_H
+
+#include "opendnp3/master/ISOEHandler.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * The last value of every static measurement held by a MeasurementCache, ordered by index
+ */
+struct MeasurementSnapshot
+{
+    std::vector<Indexed<Binary>> binaries;
+    std::vector<Indexed<DoubleBitBinary>> doubleBitBinaries;
+    std::vector<Indexed<Analog>> analogs;
+    std::vector<Indexed<Counter>> counters;
+    std::vector<Indexed<FrozenCounter>> frozenCounters;
+    std::vector<Indexed<BinaryOutputStatus>> binaryOutputStatii;
+    std::vector<Indexed<AnalogOutputStatus>> analogOutputStatii;
+};
+
+/**
+ * An ISOEHandler that keeps the last value reported for every (type, index) of a master and only forwards the
+ * static values that changed to the wrapped handler.
+ *
+ * A value is unchanged when both its value and flags match the last value seen for its index, the timestamp is not
+ * compared. Event headers are always forwarded untouched but still update the table, so an integrity poll that
+ * follows an event doesn't report the same value again. The values of each type are held in an array indexed by
+ * point index that grows to fit the largest index seen.
+ *
+ * Create one cache per master and pass it to IChannel::AddMaster in place of the handler it wraps. The query methods
+ * may be called from any thread.
+ */
+class MeasurementCache final : public ISOEHandler
+{
+
+public:
+    enum class Unchanged : uint8_t
+    {
+        /// unchanged static values are not forwarded at all
+        Drop,
+        /// unchanged static values are forwarded after the changed values of the header with HeaderInfo::isUnchanged
+        Flag
+    };
+
+    MeasurementCache(std::shared_ptr<ISOEHandler> handler, Unchanged unchanged = Unchanged::Drop);
+
+    static std::shared_ptr<MeasurementCache> Create(std::shared_ptr<ISOEHandler> handler,
+                                                    Unchanged unchanged = Unchanged::Drop)
+    {
+        return std::make_shared<MeasurementCache>(std::move(handler), unchanged);
+    }
+
+    /// Retrieve the last value of a point, returning false if no value has been reported for the index
+    bool Get(uint16_t index, Binary& value) const;
+    bool Get(uint16_t index, DoubleBitBinary& value) const;
+    bool Get(uint16_t index, Analog& value) const;
+    bool Get(uint16_t index, Counter& value) const;
+    bool Get(uint16_t index, FrozenCounter& value) const;
+    bool Get(uint16_t index, BinaryOutputStatus& value) const;
+    bool Get(uint16_t index, AnalogOutputStatus& value) const;
+
+    /// Copy the last value of every point
+    MeasurementSnapshot Snapshot() const;
+
+    /// Forget every value so that the next report of each point is forwarded as a change
+    void Clear();
+
+    void BeginFragment(const ResponseInfo& info) override;
+    void EndFragment(const ResponseInfo& info) override;
+
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override;
+    void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override;
+
+private:
+    template<class T> class Table
+    {
+    public:
+        // record the value, returning false if it matches the value and flags already held for the index
+        bool Update(const Indexed<T>& item);
+
+        bool Get(uint16_t index, T& value) const;
+
+        void CopyTo(std::vector<Indexed<T>>& dest) const;
+
+        void Clear();
+
+        // the values of the header being processed, only used on the thread that calls Process
+        std::vector<Indexed<T>> changed;
+        std::vector<Indexed<T>> unchanged;
+
+    private:
+        struct Entry
+        {
+            T value;
+            bool present = false;
+        };
+
+        std::vector<Entry> entries;
+    };
+
+    template<class T> void Filter(const HeaderInfo& info, const ICollection<Indexed<T>>& values, Table<T>& table);
+
+    const std::shared_ptr<ISOEHandler> handler;
+    const Unchanged unchanged;
+
+    mutable std::mutex mutex;
+
+    Table<Binary> binaries;
+    Table<DoubleBitBinary> doubleBitBinaries;
+    Table<Analog> analogs;
+    Table<Counter> counters;
+    Table<FrozenCounter> frozenCounters;
+    Table<BinaryOutputStatus> binaryOutputStatii;
+    Table<AnalogOutputStatus> analogOutputStatii;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -51,6 +51,21 @@ public:
      * Apply a set of measurement updates to the outstation
      */
     virtual void Apply(const Updates& updates) = 0;
+
+    /**
+     * Apply a set of measurement updates to the outstation without growing an unbounded queue
+     *
+     * If the outstation is configured with an update queue (OutstationParams::updateQueueSize), the updates
+     * are pushed into it directly from the calling thread.
+     *
+     * @return false if the update queue is full, or still holds updates that overflowed it, and the updates were
+     * not applied
+     */
+    virtual bool TryApply(const Updates& updates)
+    {
+        this->Apply(updates);
+        return true;
+    }
 };
 
 } // namespace opendnp3
@@ -73,6 +73,15 @@ struct OutstationParams
     /// If true, the outstation processes responds to any request/confirmation as if it came from the expected master
     /// address
     bool respondToAnyMaster = false;
+
+    /// Capacity of the lock-free queue that IOutstation::Apply and TryApply write into. Producers push directly into
+    /// the queue and the outstation drains it with a single task. If 0, every set of updates is posted individually.
+    uint32_t updateQueueSize = 0;
+
+    /// If true, EventMode::Suppress and EventMode::Detect updates to a Class 0 point only store the latest value.
+    /// Event detection for such a point is deferred until the next update that can produce an event or until the
+    /// point is assigned to an event class. Event generation for event class points is unchanged.
+    bool coalesceStaticUpdates = false;
 };
 
 } // namespace opendnp3
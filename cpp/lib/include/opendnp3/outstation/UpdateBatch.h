@@ -0,0 +1,218 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_UPDATEBATCH_H
+#define OPENDNP3_UPDATEBATCH_H
+
+#include "opendnp3/outstation/IUpdateHandler.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * A columnar batch of measurement updates
+ *
+ * Each kind of update is recorded into its own contiguous array of records. The order in which
+ * updates were recorded is kept as runs of consecutive records of the same kind, so that applying
+ * the batch preserves the original ordering while walking each array sequentially.
+ *
+ * Clear() retains the allocated capacity so that a batch can be reused across update cycles.
+ */
+class UpdateBatch final : public IUpdateHandler
+{
+public:
+    /// A measurement update
+    template<class T> struct Record
+    {
+        T meas;
+        uint16_t index;
+        EventMode mode;
+    };
+
+    /// A request to freeze a counter
+    struct FreezeRecord
+    {
+        uint16_t index;
+        bool clear;
+        EventMode mode;
+    };
+
+    /// A request to modify the flags of a range of points
+    struct ModifyRecord
+    {
+        FlagsType type;
+        uint16_t start;
+        uint16_t stop;
+        uint8_t flags;
+    };
+
+    bool Update(const Binary& meas, uint16_t index, EventMode mode = EventMode::Detect) override;
+    bool Update(const DoubleBitBinary& meas, uint16_t index, EventMode mode = EventMode::Detect) override;
+    bool Update(const Analog& meas, uint16_t index, EventMode mode = EventMode::Detect) override;
+    bool Update(const Counter& meas, uint16_t index, EventMode mode = EventMode::Detect) override;
+    bool FreezeCounter(uint16_t index, bool clear = false, EventMode mode = EventMode::Detect) override;
+    bool Update(const BinaryOutputStatus& meas, uint16_t index, EventMode mode = EventMode::Detect) override;
+    bool Update(const AnalogOutputStatus& meas, uint16_t index, EventMode mode = EventMode::Detect) override;
+    bool Update(const OctetString& meas, uint16_t index, EventMode mode = EventMode::Detect) override;
+    bool Update(const TimeAndInterval& meas, uint16_t index) override;
+    bool Modify(FlagsType type, uint16_t start, uint16_t stop, uint8_t flags) override;
+
+    /**
+     * Reserve space for a number of updates of a particular kind
+     * @tparam R The record type, e.g. Record<Analog> or FreezeRecord
+     * @param count number of records to reserve
+     */
+    template<class R> void Reserve(size_t count)
+    {
+        std::get<std::vector<R>>(this->columns).reserve(count);
+    }
+
+    /// Remove all updates while retaining the allocated capacity
+    void Clear();
+
+    bool IsEmpty() const
+    {
+        return this->runs.empty();
+    }
+
+    /// @return the total number of recorded updates
+    size_t Size() const;
+
+    /**
+     * Visit the records in the order they were recorded, one run at a time
+     * @param visitor callable invoked as visitor(const R* records, size_t count) for each run
+     */
+    template<class Visitor> void ForEachRun(Visitor&& visitor) const
+    {
+        size_t cursors[num_columns] = {};
+
+        for (const auto& run : this->runs)
+        {
+            switch (run.column)
+            {
+            case (Column::binary):
+                visit_run<Column::binary>(visitor, cursors, run.count);
+                break;
+            case (Column::double_binary):
+                visit_run<Column::double_binary>(visitor, cursors, run.count);
+                break;
+            case (Column::analog):
+                visit_run<Column::analog>(visitor, cursors, run.count);
+                break;
+            case (Column::counter):
+                visit_run<Column::counter>(visitor, cursors, run.count);
+                break;
+            case (Column::freeze):
+                visit_run<Column::freeze>(visitor, cursors, run.count);
+                break;
+            case (Column::binary_output_status):
+                visit_run<Column::binary_output_status>(visitor, cursors, run.count);
+                break;
+            case (Column::analog_output_status):
+                visit_run<Column::analog_output_status>(visitor, cursors, run.count);
+                break;
+            case (Column::octet_string):
+                visit_run<Column::octet_string>(visitor, cursors, run.count);
+                break;
+            case (Column::time_and_interval):
+                visit_run<Column::time_and_interval>(visitor, cursors, run.count);
+                break;
+            case (Column::modify):
+                visit_run<Column::modify>(visitor, cursors, run.count);
+                break;
+            }
+        }
+    }
+
+    /**
+     * Apply every update to a handler in the order they were recorded
+     */
+    void Apply(IUpdateHandler& handler) const;
+
+private:
+    // must match the order of the types in columns_t
+    enum class Column : uint8_t
+    {
+        binary,
+        double_binary,
+        analog,
+        counter,
+        freeze,
+        binary_output_status,
+        analog_output_status,
+        octet_string,
+        time_and_interval,
+        modify
+    };
+
+    static constexpr size_t num_columns = 10;
+
+    using columns_t = std::tuple<std::vector<Record<Binary>>,
+                                 std::vector<Record<DoubleBitBinary>>,
+                                 std::vector<Record<Analog>>,
+                                 std::vector<Record<Counter>>,
+                                 std::vector<FreezeRecord>,
+                                 std::vector<Record<BinaryOutputStatus>>,
+                                 std::vector<Record<AnalogOutputStatus>>,
+                                 std::vector<Record<OctetString>>,
+                                 std::vector<Record<TimeAndInterval>>,
+                                 std::vector<ModifyRecord>>;
+
+    struct Run
+    {
+        Column column;
+        uint32_t count;
+    };
+
+    template<Column C, class R> bool Add(const R& record)
+    {
+        std::get<static_cast<size_t>(C)>(this->columns).push_back(record);
+
+        if (!this->runs.empty() && this->runs.back().column == C)
+        {
+            ++this->runs.back().count;
+        }
+        else
+        {
+            this->runs.push_back(Run{C, 1});
+        }
+
+        return true;
+    }
+
+    template<Column C, class Visitor> void visit_run(Visitor& visitor, size_t* cursors, size_t count) const
+    {
+        const auto& column = std::get<static_cast<size_t>(C)>(this->columns);
+        auto& cursor = cursors[static_cast<size_t>(C)];
+        visitor(column.data() + cursor, count);
+        cursor += count;
+    }
+
+    columns_t columns;
+    std::vector<Run> runs;
+};
+
+} // namespace opendnp3
+
+#endif
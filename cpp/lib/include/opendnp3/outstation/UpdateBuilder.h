@@ -41,14 +41,21 @@ public:
     bool Update(const TimeAndInterval& meas, uint16_t index) override;
     bool Modify(FlagsType type, uint16_t start, uint16_t stop, uint8_t flags) override;
 
+    /**
+     * Reserve space for a number of updates of a particular kind
+     * @tparam R The record type, e.g. UpdateBatch::Record<Analog>
+     */
+    template<class R> void Reserve(size_t count)
+    {
+        this->GetBatch().Reserve<R>(count);
+    }
+
     Updates Build();
 
 private:
-    template<class T> bool AddMeas(const T& meas, uint16_t index, EventMode mode);
-
-    bool Add(const update_func_t& fun);
+    UpdateBatch& GetBatch();
 
-    std::shared_ptr<shared_updates_t> updates;
+    std::shared_ptr<UpdateBatch> batch;
 };
 
 } // namespace opendnp3
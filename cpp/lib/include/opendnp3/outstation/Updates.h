@@ -21,42 +21,48 @@
 #define OPENDNP3_UPDATES_H
 
 #include "opendnp3/outstation/IUpdateHandler.h"
+#include "opendnp3/outstation/UpdateBatch.h"
 
-#include <functional>
 #include <memory>
-#include <vector>
 
 namespace opendnp3
 {
 
-typedef std::function<void(IUpdateHandler&)> update_func_t;
-typedef std::vector<update_func_t> shared_updates_t;
-
 class Updates
 {
     friend class UpdateBuilder;
 
 public:
+    /**
+     * Construct from a batch of updates
+     */
+    explicit Updates(UpdateBatch&& batch) : batch(std::make_shared<const UpdateBatch>(std::move(batch))) {}
+
     void Apply(IUpdateHandler& handler) const
     {
-        if (!updates)
+        if (!batch)
             return;
 
-        for (auto& update : *updates)
-        {
-            update(handler);
-        }
+        batch->Apply(handler);
     }
 
     bool IsEmpty() const
     {
-        return updates ? updates->empty() : true;
+        return batch ? batch->IsEmpty() : true;
+    }
+
+    /**
+     * @return the recorded updates, or nullptr if there are none
+     */
+    const UpdateBatch* GetBatch() const
+    {
+        return batch.get();
     }
 
 private:
-    Updates(std::shared_ptr<shared_updates_t> updates) : updates(std::move(updates)) {}
+    Updates(std::shared_ptr<const UpdateBatch> batch) : batch(std::move(batch)) {}
 
-    const std::shared_ptr<shared_updates_t> updates;
+    const std::shared_ptr<const UpdateBatch> batch;
 };
 
 } // namespace opendnp3
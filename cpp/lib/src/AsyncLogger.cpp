@@ -0,0 +1,379 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "opendnp3/AsyncLogger.h"
+
+#include "logging/LogRecordFormat.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace opendnp3
+{
+
+namespace
+{
+    // a log call copied into storage owned by the ring, strings are truncated to fit
+    struct Record
+    {
+        int64_t timestamp;
+        ModuleId module;
+        LogLevel level;
+        uint16_t idLength;
+        uint16_t locationLength;
+        uint16_t messageLength;
+        char id[48];
+        char location[96];
+        char message[344];
+    };
+
+    template<size_t N> uint16_t CopyTruncated(char (&dest)[N], const char* source)
+    {
+        size_t length = 0;
+        while (length < (N - 1) && source[length] != '\0')
+        {
+            dest[length] = source[length];
+            ++length;
+        }
+        dest[length] = '\0';
+        return static_cast<uint16_t>(length);
+    }
+
+    uint32_t RoundUpToPowerOfTwo(uint32_t value)
+    {
+        uint32_t result = 1;
+        while (result < value && result < (1u << 31))
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    std::atomic<uint64_t> nextInstanceId(1);
+
+    // the ring of the last AsyncLogger this thread used, so that logging does not need a lookup
+    struct ThreadRingCache
+    {
+        uint64_t instance = 0;
+        void* ring = nullptr;
+    };
+
+    thread_local ThreadRingCache threadRingCache;
+} // namespace
+
+class AsyncLoggerImpl
+{
+    // single producer, single consumer ring of records owned by one logging thread
+    class Ring
+    {
+    public:
+        explicit Ring(uint32_t capacity) : records(capacity), mask(capacity - 1) {}
+
+        bool Push(ModuleId module, const char* id, LogLevel level, const char* location, const char* message)
+        {
+            const auto tail = this->tail.load(std::memory_order_relaxed);
+            if (tail - this->head.load(std::memory_order_acquire) >= this->records.size())
+            {
+                this->dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            auto& record = this->records[tail & this->mask];
+            const auto now = std::chrono::system_clock::now().time_since_epoch();
+            record.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+            record.module = module;
+            record.level = level;
+            record.idLength = CopyTruncated(record.id, id);
+            record.locationLength = CopyTruncated(record.location, location);
+            record.messageLength = CopyTruncated(record.message, message);
+
+            this->tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        template<class Output> size_t Drain(const Output& output)
+        {
+            const auto head = this->head.load(std::memory_order_relaxed);
+            const auto tail = this->tail.load(std::memory_order_acquire);
+
+            for (auto i = head; i != tail; ++i)
+            {
+                output(this->records[i & this->mask]);
+            }
+
+            this->head.store(tail, std::memory_order_release);
+            return static_cast<size_t>(tail - head);
+        }
+
+        uint64_t NumDropped() const
+        {
+            return this->dropped.load(std::memory_order_relaxed);
+        }
+
+        // only used by the consumer
+        uint64_t numDroppedReported = 0;
+
+    private:
+        std::vector<Record> records;
+        const uint64_t mask;
+        std::atomic<uint64_t> head{0};
+        std::atomic<uint64_t> tail{0};
+        std::atomic<uint64_t> dropped{0};
+    };
+
+public:
+    AsyncLoggerImpl(const AsyncLoggerConfig& config, std::unique_ptr<std::ofstream> file)
+        : instance(nextInstanceId++),
+          capacity(RoundUpToPowerOfTwo(config.recordsPerThread)),
+          flushPeriod(std::chrono::duration_cast<std::chrono::milliseconds>(config.flushPeriod.value)),
+          printLocation(config.printLocation),
+          file(std::move(file)),
+          binary(this->file != nullptr),
+          output(this->file ? static_cast<std::ostream&>(*this->file) : std::cout),
+          thread([this]() { this->Run(); })
+    {
+    }
+
+    ~AsyncLoggerImpl()
+    {
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->isShutdown = true;
+        }
+        this->wakeup.notify_one();
+        this->thread.join();
+    }
+
+    void Log(ModuleId module, const char* id, LogLevel level, char const* location, char const* message)
+    {
+        this->GetRing().Push(module, id, level, location, message);
+    }
+
+    void Flush()
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        const auto target = ++this->flushRequested;
+        this->wakeup.notify_one();
+        this->flushed.wait(lock, [&]() { return this->flushCompleted >= target || this->isShutdown; });
+    }
+
+    uint64_t NumLogged() const
+    {
+        return this->numLogged.load(std::memory_order_relaxed);
+    }
+
+    uint64_t NumDropped() const
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        uint64_t total = 0;
+        for (auto& ring : this->rings)
+        {
+            total += ring.second->NumDropped();
+        }
+        return total;
+    }
+
+private:
+    Ring& GetRing()
+    {
+        if (threadRingCache.instance == this->instance)
+        {
+            return *static_cast<Ring*>(threadRingCache.ring);
+        }
+
+        // first message from this thread, or the thread last logged to another AsyncLogger
+        std::unique_lock<std::mutex> lock(this->mutex);
+        auto& ring = this->rings[std::this_thread::get_id()];
+        if (!ring)
+        {
+            ring = std::make_unique<Ring>(this->capacity);
+        }
+
+        threadRingCache.instance = this->instance;
+        threadRingCache.ring = ring.get();
+
+        return *ring;
+    }
+
+    void Run()
+    {
+        if (this->binary)
+        {
+            this->output.write(reinterpret_cast<const char*>(LogRecordFormat::header), sizeof(LogRecordFormat::header));
+        }
+
+        std::vector<Ring*> snapshot;
+
+        while (true)
+        {
+            uint64_t flushTarget = 0;
+            bool stop = false;
+
+            {
+                std::unique_lock<std::mutex> lock(this->mutex);
+                const auto isWakeupRequired
+                    = [this]() { return this->isShutdown || this->flushRequested > this->flushCompleted; };
+                this->wakeup.wait_for(lock, this->flushPeriod, isWakeupRequired);
+
+                stop = this->isShutdown;
+                flushTarget = this->flushRequested;
+
+                // rings are never removed, so they can be drained without holding the lock
+                snapshot.clear();
+                for (auto& ring : this->rings)
+                {
+                    snapshot.push_back(ring.second.get());
+                }
+            }
+
+            for (auto ring : snapshot)
+            {
+                this->Drain(*ring);
+            }
+
+            this->output.flush();
+
+            {
+                std::unique_lock<std::mutex> lock(this->mutex);
+                this->flushCompleted = flushTarget;
+            }
+            this->flushed.notify_all();
+
+            if (stop)
+            {
+                return;
+            }
+        }
+    }
+
+    void Drain(Ring& ring)
+    {
+        const auto count = ring.Drain([this](const Record& record) { this->Write(record); });
+        this->numLogged.fetch_add(count, std::memory_order_relaxed);
+
+        // report drops in the output itself, at the point where they occurred
+        const auto dropped = ring.NumDropped();
+        if (dropped != ring.numDroppedReported)
+        {
+            Record record;
+            record.module = ModuleId();
+            record.level = flags::WARN;
+            record.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                   std::chrono::system_clock::now().time_since_epoch())
+                                   .count();
+            record.idLength = CopyTruncated(record.id, "async-logger");
+            record.locationLength = CopyTruncated(record.location, "");
+            const auto message = std::to_string(dropped - ring.numDroppedReported) + " messages dropped, ring full";
+            record.messageLength = CopyTruncated(record.message, message.c_str());
+
+            this->Write(record);
+            ring.numDroppedReported = dropped;
+        }
+    }
+
+    void Write(const Record& record)
+    {
+        if (this->binary)
+        {
+            uint8_t buffer[LogRecordFormat::fixed_record_size + sizeof(Record::id) + sizeof(Record::location)
+                           + sizeof(Record::message)];
+            const auto length = LogRecordFormat::Write(buffer, record.timestamp, record.module, record.level,
+                                                       record.id, record.idLength, record.location,
+                                                       record.locationLength, record.message, record.messageLength);
+            this->output.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(length));
+        }
+        else
+        {
+            LogRecordFormat::Print(this->output, record.timestamp, record.level, record.id, record.location,
+                                   record.message, this->printLocation);
+        }
+    }
+
+    const uint64_t instance;
+    const uint32_t capacity;
+    const std::chrono::milliseconds flushPeriod;
+    const bool printLocation;
+
+    const std::unique_ptr<std::ofstream> file;
+    const bool binary;
+    std::ostream& output;
+
+    std::atomic<uint64_t> numLogged{0};
+
+    mutable std::mutex mutex;
+    std::condition_variable wakeup;
+    std::condition_variable flushed;
+    bool isShutdown = false;
+    uint64_t flushRequested = 0;
+    uint64_t flushCompleted = 0;
+    std::unordered_map<std::thread::id, std::unique_ptr<Ring>> rings;
+
+    // declared last so that it starts after everything it uses is initialized
+    std::thread thread;
+};
+
+std::shared_ptr<AsyncLogger> AsyncLogger::Create(const AsyncLoggerConfig& config)
+{
+    return std::make_shared<AsyncLogger>(std::make_unique<AsyncLoggerImpl>(config, nullptr));
+}
+
+std::shared_ptr<AsyncLogger> AsyncLogger::CreateBinary(const std::string& path, const AsyncLoggerConfig& config)
+{
+    auto file = std::make_unique<std::ofstream>(path, std::ios::binary | std::ios::trunc);
+    if (!file->is_open())
+    {
+        throw std::runtime_error("Unable to open log file: " + path);
+    }
+
+    return std::make_shared<AsyncLogger>(std::make_unique<AsyncLoggerImpl>(config, std::move(file)));
+}
+
+AsyncLogger::AsyncLogger(std::unique_ptr<AsyncLoggerImpl> impl) : impl(std::move(impl)) {}
+
+AsyncLogger::~AsyncLogger() = default;
+
+void AsyncLogger::log(ModuleId module, const char* id, LogLevel level, char const* location, char const* message)
+{
+    this->impl->Log(module, id, level, location, message);
+}
+
+void AsyncLogger::Flush()
+{
+    this->impl->Flush();
+}
+
+uint64_t AsyncLogger::NumLogged() const
+{
+    return this->impl->NumLogged();
+}
+
+uint64_t AsyncLogger::NumDropped() const
+{
+    return this->impl->NumDropped();
+}
+
+} // namespace opendnp3
@@ -29,8 +29,9 @@ namespace opendnp3
 DNP3Manager::DNP3Manager(uint32_t concurrencyHint,
                          std::shared_ptr<ILogHandler> handler,
                          std::function<void(uint32_t)> onThreadStart,
-                         std::function<void(uint32_t)> onThreadExit)
-    : impl(std::make_unique<DNP3ManagerImpl>(concurrencyHint, handler, onThreadStart, onThreadExit))
+                         std::function<void(uint32_t)> onThreadExit,
+                         IOContextMode contextMode)
+    : impl(std::make_unique<DNP3ManagerImpl>(concurrencyHint, handler, onThreadStart, onThreadExit, contextMode))
 {
 }
 
@@ -46,12 +46,36 @@ namespace opendnp3
 DNP3ManagerImpl::DNP3ManagerImpl(uint32_t concurrencyHint,
                                  std::shared_ptr<ILogHandler> handler,
                                  std::function<void(uint32_t)> onThreadStart,
-                                 std::function<void(uint32_t)> onThreadExit)
+                                 std::function<void(uint32_t)> onThreadExit,
+                                 IOContextMode contextMode)
     : logger(std::move(handler), ModuleId(), "manager", levels::ALL),
-      io(std::make_shared<ASIO::io_context>()),
-      threadpool(io, concurrencyHint, std::move(onThreadStart), std::move(onThreadExit)),
+      nextContext(0),
       resources(ResourceManager::Create())
 {
+    if (contextMode == IOContextMode::PerThread)
+    {
+        const auto numThreads = (concurrencyHint == 0) ? 1 : concurrencyHint;
+
+        for (uint32_t i = 0; i < numThreads; ++i)
+        {
+            // a context run by a single thread lets asio skip the locking of its handler queue
+            auto io = std::make_shared<ASIO::io_context>(1);
+
+            // each pool has a single thread, report the index of that thread within the manager
+            auto start = [onThreadStart, i](uint32_t) { onThreadStart(i); };
+            auto exit = [onThreadExit, i](uint32_t) { onThreadExit(i); };
+
+            this->threadpools.push_back(std::make_unique<exe4cpp::ThreadPool>(io, 1, start, exit));
+            this->contexts.push_back(std::move(io));
+        }
+    }
+    else
+    {
+        auto io = std::make_shared<ASIO::io_context>();
+        auto pool = std::make_unique<exe4cpp::ThreadPool>(io, concurrencyHint, onThreadStart, onThreadExit);
+        this->threadpools.push_back(std::move(pool));
+        this->contexts.push_back(std::move(io));
+    }
 }
 
 DNP3ManagerImpl::~DNP3ManagerImpl()
@@ -68,6 +92,13 @@ void DNP3ManagerImpl::Shutdown()
     }
 }
 
+std::shared_ptr<exe4cpp::StrandExecutor> DNP3ManagerImpl::CreateExecutor()
+{
+    // the strands forked by a channel for its sessions stay on the same context
+    const auto index = this->nextContext++ % this->contexts.size();
+    return exe4cpp::StrandExecutor::create(this->contexts[index]);
+}
+
 std::shared_ptr<IChannel> DNP3ManagerImpl::AddTCPClient(const std::string& id,
                                                         const LogLevels& levels,
                                                         const ChannelRetry& retry,
@@ -77,7 +108,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTCPClient(const std::string& id,
 {
     auto create = [&]() -> std::shared_ptr<IChannel> {
         auto clogger = this->logger.detach(id, levels);
-        auto executor = exe4cpp::StrandExecutor::create(this->io);
+        auto executor = this->CreateExecutor();
         auto iohandler = TCPClientIOHandler::Create(clogger, listener, executor, retry, IPEndpointsList(hosts), local);
         return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
     };
@@ -101,7 +132,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTCPServer(const std::string& id,
     auto create = [&]() -> std::shared_ptr<IChannel> {
         ASIO_ERROR ec;
         auto clogger = this->logger.detach(id, levels);
-        auto executor = exe4cpp::StrandExecutor::create(this->io);
+        auto executor = this->CreateExecutor();
         auto iohandler = TCPServerIOHandler::Create(clogger, mode, listener, executor, endpoint, ec);
         if (ec)
         {
@@ -129,7 +160,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddUDPChannel(const std::string& id,
 {
     auto create = [&]() -> std::shared_ptr<IChannel> {
         auto clogger = this->logger.detach(id, levels);
-        auto executor = exe4cpp::StrandExecutor::create(this->io);
+        auto executor = this->CreateExecutor();
         auto iohandler = UDPClientIOHandler::Create(clogger, listener, executor, retry, localEndpoint, remoteEndpoint);
         return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
     };
@@ -152,7 +183,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddSerial(const std::string& id,
 {
     auto create = [&]() -> std::shared_ptr<IChannel> {
         auto clogger = this->logger.detach(id, levels);
-        auto executor = exe4cpp::StrandExecutor::create(this->io);
+        auto executor = this->CreateExecutor();
         auto iohandler = SerialIOHandler::Create(clogger, listener, executor, retry, settings);
         return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
     };
@@ -179,7 +210,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSClient(const std::string& id,
 #ifdef OPENDNP3_USE_TLS
     auto create = [&]() -> std::shared_ptr<IChannel> {
         auto clogger = this->logger.detach(id, levels);
-        auto executor = exe4cpp::StrandExecutor::create(this->io);
+        auto executor = this->CreateExecutor();
         auto iohandler = TLSClientIOHandler::Create(clogger, listener, executor, config, retry, hosts, local);
         return DNP3Channel::Create(clogger, executor, iohandler, this->resources);
     };
@@ -209,7 +240,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddTLSServer(const std::string& id,
     auto create = [&]() -> std::shared_ptr<IChannel> {
         ASIO_ERROR ec;
         auto clogger = this->logger.detach(id, levels);
-        auto executor = exe4cpp::StrandExecutor::create(this->io);
+        auto executor = this->CreateExecutor();
         auto iohandler = TLSServerIOHandler::Create(clogger, mode, listener, executor, endpoint, config, ec);
         if (ec)
         {
@@ -239,7 +270,7 @@ std::shared_ptr<IChannel> DNP3ManagerImpl::AddSharedTcpServer(const std::string&
                                                               TLSConfig* config)
 {
     auto clogger = this->logger.detach(id, levels);
-    auto executor = exe4cpp::StrandExecutor::create(this->io);
+    auto executor = this->CreateExecutor();
     auto crateServer = [&, this]() -> std::shared_ptr<SharedTcpServer> {
         ASIO_ERROR ec;
         std::shared_ptr<SharedTcpServer> server;
@@ -294,7 +325,7 @@ std::shared_ptr<IListener> DNP3ManagerImpl::CreateListener(std::string loggerid,
     auto create = [&]() -> std::shared_ptr<IListener> {
         ASIO_ERROR ec;
         auto server
-            = MasterTCPServer::Create(this->logger.detach(loggerid, levels), exe4cpp::StrandExecutor::create(this->io),
+            = MasterTCPServer::Create(this->logger.detach(loggerid, levels), this->CreateExecutor(),
                                       endpoint, callbacks, this->resources, ec);
         if (ec)
         {
@@ -325,7 +356,7 @@ std::shared_ptr<IListener> DNP3ManagerImpl::CreateListener(std::string loggerid,
     auto create = [&]() -> std::shared_ptr<IListener> {
         ASIO_ERROR ec;
         auto server
-            = MasterTLSServer::Create(this->logger.detach(loggerid, levels), exe4cpp::StrandExecutor::create(this->io),
+            = MasterTLSServer::Create(this->logger.detach(loggerid, levels), this->CreateExecutor(),
                                       endpoint, config, callbacks, this->resources, ec);
         if (ec)
         {
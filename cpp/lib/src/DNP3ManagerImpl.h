@@ -27,6 +27,7 @@
 #include "opendnp3/channel/IChannel.h"
 #include "opendnp3/channel/IChannelListener.h"
 #include "opendnp3/channel/IListener.h"
+#include "opendnp3/channel/IOContextMode.h"
 #include "opendnp3/channel/IPEndpoint.h"
 #include "opendnp3/channel/SerialSettings.h"
 #include "opendnp3/channel/TLSConfig.h"
@@ -35,8 +36,13 @@
 #include "opendnp3/master/IListenCallbacks.h"
 #include "opendnp3/util/Uncopyable.h"
 
+#include <exe4cpp/asio/StrandExecutor.h>
 #include <exe4cpp/asio/ThreadPool.h>
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 namespace opendnp3
 {
 
@@ -47,7 +53,8 @@ public:
     DNP3ManagerImpl(uint32_t concurrencyHint,
                     std::shared_ptr<opendnp3::ILogHandler> handler,
                     std::function<void(uint32_t)> onThreadStart,
-                    std::function<void(uint32_t)> onThreadExit);
+                    std::function<void(uint32_t)> onThreadExit,
+                    IOContextMode contextMode);
 
     ~DNP3ManagerImpl();
 
@@ -112,9 +119,14 @@ public:
                                               const std::shared_ptr<IListenCallbacks>& callbacks);
 
 private:
+    // strand for a new channel or listener, on the next io_context in round robin order
+    std::shared_ptr<exe4cpp::StrandExecutor> CreateExecutor();
+
     Logger logger;
-    const std::shared_ptr<ASIO::io_context> io;
-    exe4cpp::ThreadPool threadpool;
+    // a single io_context shared by all threads, or one io_context per thread
+    std::vector<std::shared_ptr<ASIO::io_context>> contexts;
+    std::vector<std::unique_ptr<exe4cpp::ThreadPool>> threadpools;
+    std::atomic<uint32_t> nextContext;
     std::shared_ptr<ResourceManager> resources;
 };
 
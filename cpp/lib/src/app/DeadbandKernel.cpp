@@ -0,0 +1,304 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "app/DeadbandKernel.h"
+
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#define OPENDNP3_DEADBAND_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define OPENDNP3_DEADBAND_AVX2
+#define OPENDNP3_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER)
+#define OPENDNP3_DEADBAND_AVX2
+#define OPENDNP3_TARGET_AVX2
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+#endif
+
+namespace opendnp3
+{
+
+namespace
+{
+    // the same rules as measurements::IsEvent, applied to a single lane
+
+    bool is_event(double old_value, double new_value, double deadband)
+    {
+        const double diff = fabs(new_value - old_value);
+        return (diff == INFINITY) || (diff > deadband);
+    }
+
+    bool is_event(uint32_t old_value, uint32_t new_value, uint32_t deadband)
+    {
+        return measurements::IsEvent<uint32_t, uint64_t>(old_value, new_value, deadband);
+    }
+
+    template<class T> uint64_t detect_events_scalar(const DeadbandBlock<T>& block, size_t begin, size_t count)
+    {
+        uint64_t mask = 0;
+        for (size_t i = begin; i < count; ++i)
+        {
+            if ((block.old_flags[i] != block.new_flags[i])
+                || is_event(block.old_values[i], block.new_values[i], block.deadbands[i]))
+            {
+                mask |= uint64_t(1) << i;
+            }
+        }
+        return mask;
+    }
+
+    // @return a mask of the lanes in [begin, end) whose flags differ
+    template<class T> uint64_t detect_flag_changes(const DeadbandBlock<T>& block, size_t begin, size_t end)
+    {
+        uint64_t mask = 0;
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (block.old_flags[i] != block.new_flags[i])
+            {
+                mask |= uint64_t(1) << i;
+            }
+        }
+        return mask;
+    }
+
+#ifdef OPENDNP3_DEADBAND_SSE2
+
+    // compare the flags 16 lanes at a time starting from 0, advancing 'end' past the lanes that were compared
+    template<class T> uint64_t detect_flag_changes_sse2(const DeadbandBlock<T>& block, size_t& end, size_t count)
+    {
+        uint64_t mask = 0;
+        for (; end + 16 <= count; end += 16)
+        {
+            const auto old_flags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.old_flags + end));
+            const auto new_flags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.new_flags + end));
+            const auto equal = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(old_flags, new_flags)));
+            mask |= static_cast<uint64_t>(~equal & 0xFFFF) << end;
+        }
+        return mask;
+    }
+
+    uint64_t detect_events_sse2(const DeadbandBlock<double>& block, size_t count)
+    {
+        size_t flags_end = 0;
+        uint64_t mask = detect_flag_changes_sse2(block, flags_end, count);
+
+        const auto sign = _mm_set1_pd(-0.0);
+        const auto infinity = _mm_set1_pd(INFINITY);
+
+        size_t i = 0;
+        for (; i + 2 <= count; i += 2)
+        {
+            const auto new_values = _mm_loadu_pd(block.new_values + i);
+            const auto diff = _mm_andnot_pd(sign, _mm_sub_pd(new_values, _mm_loadu_pd(block.old_values + i)));
+            const auto event
+                = _mm_or_pd(_mm_cmpgt_pd(diff, _mm_loadu_pd(block.deadbands + i)), _mm_cmpeq_pd(diff, infinity));
+            mask |= static_cast<uint64_t>(_mm_movemask_pd(event)) << i;
+        }
+
+        return mask | detect_flag_changes(block, flags_end, i) | detect_events_scalar(block, i, count);
+    }
+
+    uint64_t detect_events_sse2(const DeadbandBlock<uint32_t>& block, size_t count)
+    {
+        size_t flags_end = 0;
+        uint64_t mask = detect_flag_changes_sse2(block, flags_end, count);
+
+        // SSE2 only has signed comparisons, so bias the values to compare them as unsigned
+        const auto bias = _mm_set1_epi32(static_cast<int>(0x80000000));
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const auto old_values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.old_values + i));
+            const auto new_values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.new_values + i));
+            const auto deadbands = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block.deadbands + i));
+
+            const auto decreased
+                = _mm_cmpgt_epi32(_mm_xor_si128(old_values, bias), _mm_xor_si128(new_values, bias));
+            const auto diff = _mm_or_si128(_mm_and_si128(decreased, _mm_sub_epi32(old_values, new_values)),
+                                           _mm_andnot_si128(decreased, _mm_sub_epi32(new_values, old_values)));
+            const auto event = _mm_cmpgt_epi32(_mm_xor_si128(diff, bias), _mm_xor_si128(deadbands, bias));
+            mask |= static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(event))) << i;
+        }
+
+        return mask | detect_flag_changes(block, flags_end, i) | detect_events_scalar(block, i, count);
+    }
+
+#endif
+
+#ifdef OPENDNP3_DEADBAND_AVX2
+
+    // compare the flags 32 lanes at a time starting from 0, advancing 'end' past the lanes that were compared
+    template<class T>
+    OPENDNP3_TARGET_AVX2 uint64_t detect_flag_changes_avx2(const DeadbandBlock<T>& block, size_t& end, size_t count)
+    {
+        uint64_t mask = 0;
+        for (; end + 32 <= count; end += 32)
+        {
+            const auto old_flags = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block.old_flags + end));
+            const auto new_flags = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block.new_flags + end));
+            const auto equal = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(old_flags, new_flags)));
+            mask |= static_cast<uint64_t>(~equal) << end;
+        }
+        return mask;
+    }
+
+    OPENDNP3_TARGET_AVX2 uint64_t detect_events_avx2(const DeadbandBlock<double>& block, size_t count)
+    {
+        size_t flags_end = 0;
+        uint64_t mask = detect_flag_changes_avx2(block, flags_end, count);
+
+        const auto sign = _mm256_set1_pd(-0.0);
+        const auto infinity = _mm256_set1_pd(INFINITY);
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            const auto diff = _mm256_andnot_pd(
+                sign, _mm256_sub_pd(_mm256_loadu_pd(block.new_values + i), _mm256_loadu_pd(block.old_values + i)));
+            const auto event = _mm256_or_pd(_mm256_cmp_pd(diff, _mm256_loadu_pd(block.deadbands + i), _CMP_GT_OQ),
+                                            _mm256_cmp_pd(diff, infinity, _CMP_EQ_OQ));
+            mask |= static_cast<uint64_t>(_mm256_movemask_pd(event)) << i;
+        }
+
+        return mask | detect_flag_changes(block, flags_end, i) | detect_events_scalar(block, i, count);
+    }
+
+    OPENDNP3_TARGET_AVX2 uint64_t detect_events_avx2(const DeadbandBlock<uint32_t>& block, size_t count)
+    {
+        size_t flags_end = 0;
+        uint64_t mask = detect_flag_changes_avx2(block, flags_end, count);
+
+        // there are no unsigned comparisons, so bias the values to compare them as signed
+        const auto bias = _mm256_set1_epi32(static_cast<int>(0x80000000));
+
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            const auto old_values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block.old_values + i));
+            const auto new_values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block.new_values + i));
+            const auto deadbands = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block.deadbands + i));
+
+            const auto diff
+                = _mm256_sub_epi32(_mm256_max_epu32(old_values, new_values), _mm256_min_epu32(old_values, new_values));
+            const auto event = _mm256_cmpgt_epi32(_mm256_xor_si256(diff, bias), _mm256_xor_si256(deadbands, bias));
+            mask |= static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(event))) << i;
+        }
+
+        return mask | detect_flag_changes(block, flags_end, i) | detect_events_scalar(block, i, count);
+    }
+
+    bool cpu_supports_avx2()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return false;
+        }
+
+        // the OS must also save the AVX registers on context switches
+        __cpuid(info, 1);
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        if (!osxsave || !avx || ((_xgetbv(0) & 0x6) != 0x6))
+        {
+            return false;
+        }
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2") != 0;
+#endif
+    }
+
+#endif
+
+    template<class T> uint64_t dispatch(const DeadbandBlock<T>& block, size_t count, DeadbandKernel::Isa isa)
+    {
+        switch (isa)
+        {
+#ifdef OPENDNP3_DEADBAND_AVX2
+        case (DeadbandKernel::Isa::avx2):
+            return detect_events_avx2(block, count);
+#endif
+#ifdef OPENDNP3_DEADBAND_SSE2
+        case (DeadbandKernel::Isa::sse2):
+            return detect_events_sse2(block, count);
+#endif
+        default:
+            return detect_events_scalar(block, 0, count);
+        }
+    }
+
+} // namespace
+
+DeadbandKernel::Isa DeadbandKernel::best_isa()
+{
+    static const Isa best = is_supported(Isa::avx2) ? Isa::avx2 : (is_supported(Isa::sse2) ? Isa::sse2 : Isa::scalar);
+    return best;
+}
+
+bool DeadbandKernel::is_supported(Isa isa)
+{
+    switch (isa)
+    {
+    case (Isa::scalar):
+        return true;
+#ifdef OPENDNP3_DEADBAND_SSE2
+    case (Isa::sse2):
+        return true;
+#endif
+#ifdef OPENDNP3_DEADBAND_AVX2
+    case (Isa::avx2):
+        return cpu_supports_avx2();
+#endif
+    default:
+        return false;
+    }
+}
+
+uint64_t DeadbandKernel::detect_events(const DeadbandBlock<double>& block, size_t count)
+{
+    return dispatch(block, count, best_isa());
+}
+
+uint64_t DeadbandKernel::detect_events(const DeadbandBlock<uint32_t>& block, size_t count)
+{
+    return dispatch(block, count, best_isa());
+}
+
+uint64_t DeadbandKernel::detect_events(const DeadbandBlock<double>& block, size_t count, Isa isa)
+{
+    return dispatch(block, count, isa);
+}
+
+uint64_t DeadbandKernel::detect_events(const DeadbandBlock<uint32_t>& block, size_t count, Isa isa)
+{
+    return dispatch(block, count, isa);
+}
+
+} // namespace opendnp3
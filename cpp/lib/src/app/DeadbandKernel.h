@@ -0,0 +1,106 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_DEADBANDKERNEL_H
+#define OPENDNP3_DEADBANDKERNEL_H
+
+#include "app/MeasurementTypeSpecs.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace opendnp3
+{
+
+/**
+ * A block of values to compare against the values that last produced an event, stored as a structure of arrays
+ */
+template<class T> struct DeadbandBlock
+{
+    static constexpr size_t max_size = 64;
+
+    T old_values[max_size];
+    T new_values[max_size];
+    T deadbands[max_size];
+    uint8_t old_flags[max_size];
+    uint8_t new_flags[max_size];
+};
+
+/**
+ * Evaluates the change detection rules of the deadband measurement types for a whole block of values at once
+ *
+ * The result of every lane is bit-identical to the corresponding Spec::IsEvent(). The vectorized implementations
+ * are selected at runtime based on the capabilities of the CPU, with a portable scalar fallback.
+ */
+class DeadbandKernel
+{
+public:
+    enum class Isa : uint8_t
+    {
+        scalar,
+        sse2,
+        avx2
+    };
+
+    // @return the best implementation supported by this CPU
+    static Isa best_isa();
+
+    // @return true if the specified implementation can be used on this CPU
+    static bool is_supported(Isa isa);
+
+    // @return a mask with bit i set if lane i (i < count <= max_size) is an event
+    static uint64_t detect_events(const DeadbandBlock<double>& block, size_t count);
+    static uint64_t detect_events(const DeadbandBlock<uint32_t>& block, size_t count);
+
+    // same as above, but using a specific implementation that must be supported
+    static uint64_t detect_events(const DeadbandBlock<double>& block, size_t count, Isa isa);
+    static uint64_t detect_events(const DeadbandBlock<uint32_t>& block, size_t count, Isa isa);
+};
+
+/**
+ * Maps the measurement types that can use the DeadbandKernel to the type of their values
+ */
+template<class Spec> struct DeadbandKernelTraits : std::false_type
+{
+};
+
+template<> struct DeadbandKernelTraits<AnalogSpec> : std::true_type
+{
+    using value_t = double;
+};
+
+template<> struct DeadbandKernelTraits<AnalogOutputStatusSpec> : std::true_type
+{
+    using value_t = double;
+};
+
+template<> struct DeadbandKernelTraits<CounterSpec> : std::true_type
+{
+    using value_t = uint32_t;
+};
+
+template<> struct DeadbandKernelTraits<FrozenCounterSpec> : std::true_type
+{
+    using value_t = uint32_t;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -47,9 +47,17 @@ ParseResult APDUParser::Parse(const ser4cpp::rseq_t& buffer,
                               ParserSettings settings)
 {
     // do two state parsing process with logging and white-listing first but no handling on the first pass
-    auto result = ParseSinglePass(buffer, pLogger, nullptr, &handler, settings);
-    // if the first pass was successful, do a 2nd pass with the handler but no logging or white-list
-    return (result == ParseResult::OK) ? ParseSinglePass(buffer, nullptr, &handler, nullptr, settings) : result;
+    HeaderIndex index(buffer);
+    auto result = ParseSinglePass(buffer, pLogger, nullptr, &handler, settings, &index);
+    if (result != ParseResult::OK)
+    {
+        return result;
+    }
+
+    // the 2nd pass dispatches the validated headers from the index w/o parsing them again,
+    // unless there were too many headers to index in which case the whole APDU is parsed a 2nd time
+    return index.IsComplete() ? HandleIndexed(index, settings, handler)
+                              : ParseSinglePass(buffer, nullptr, &handler, nullptr, settings);
 }
 
 ParseResult APDUParser::ParseAndLogAll(const ser4cpp::rseq_t& buffer, Logger* pLogger, ParserSettings settings)
@@ -61,13 +69,14 @@ ParseResult APDUParser::ParseSinglePass(const ser4cpp::rseq_t& buffer,
                                         Logger* pLogger,
                                         IAPDUHandler* pHandler,
                                         IWhiteList* pWhiteList,
-                                        const ParserSettings& settings)
+                                        const ParserSettings& settings,
+                                        HeaderIndex* pIndex)
 {
     uint32_t count = 0;
     ser4cpp::rseq_t copy(buffer);
     while (copy.length() > 0)
     {
-        auto result = ParseHeader(copy, pLogger, count, settings, pHandler, pWhiteList);
+        auto result = ParseHeader(copy, pLogger, count, settings, pHandler, pWhiteList, pIndex);
         ++count;
         if (result != ParseResult::OK)
         {
@@ -82,7 +91,8 @@ ParseResult APDUParser::ParseHeader(ser4cpp::rseq_t& buffer,
                                     uint32_t count,
                                     const ParserSettings& settings,
                                     IAPDUHandler* pHandler,
-                                    IWhiteList* pWhiteList)
+                                    IWhiteList* pWhiteList,
+                                    HeaderIndex* pIndex)
 {
     ObjectHeader header;
     auto result = ObjectHeaderParser::ParseObjectHeader(header, buffer, pLogger);
@@ -108,7 +118,17 @@ ParseResult APDUParser::ParseHeader(ser4cpp::rseq_t& buffer,
         return ParseResult::NOT_ON_WHITELIST;
     }
 
-    return APDUParser::ParseQualifier(buffer, pLogger, HeaderRecord(GV, header.qualifier, count), settings, pHandler);
+    const HeaderRecord record(GV, header.qualifier, count);
+    const auto fields = buffer;
+
+    result = APDUParser::ParseQualifier(buffer, pLogger, record, settings, pHandler);
+
+    if (pIndex && (result == ParseResult::OK))
+    {
+        IndexHeader(*pIndex, record, fields);
+    }
+
+    return result;
 }
 
 ParseResult APDUParser::ParseQualifier(ser4cpp::rseq_t& buffer,
@@ -146,6 +166,100 @@ ParseResult APDUParser::ParseQualifier(ser4cpp::rseq_t& buffer,
     }
 }
 
+NumParser APDUParser::GetNumParser(QualifierCode qualifier)
+{
+    switch (qualifier)
+    {
+    case (QualifierCode::UINT8_CNT):
+    case (QualifierCode::UINT8_START_STOP):
+    case (QualifierCode::UINT8_CNT_UINT8_INDEX):
+        return NumParser::OneByte();
+    default:
+        return NumParser::TwoByte();
+    }
+}
+
+void APDUParser::IndexHeader(HeaderIndex& index, const HeaderRecord& record, ser4cpp::rseq_t fields)
+{
+    // the fields have already been validated, so they can be read w/o any checks
+    const auto qualifier = record.GetQualifierCode();
+    const auto numparser = GetNumParser(qualifier);
+
+    uint16_t count = 0;
+    Range range;
+
+    switch (qualifier)
+    {
+    case (QualifierCode::UINT8_CNT):
+    case (QualifierCode::UINT16_CNT):
+    case (QualifierCode::UINT8_CNT_UINT8_INDEX):
+    case (QualifierCode::UINT16_CNT_UINT16_INDEX):
+        count = numparser.ReadNum(fields);
+        break;
+    case (QualifierCode::UINT8_START_STOP):
+    case (QualifierCode::UINT16_START_STOP):
+    {
+        const auto start = numparser.ReadNum(fields);
+        const auto stop = numparser.ReadNum(fields);
+        range = Range::From(start, stop);
+        break;
+    }
+    default:
+        break;
+    }
+
+    auto header = index.Add(record, fields);
+    if (header)
+    {
+        header->count = count;
+        header->range = range;
+    }
+}
+
+ParseResult APDUParser::HandleIndexed(const HeaderIndex& index, const ParserSettings& settings, IAPDUHandler& handler)
+{
+    for (const auto& header : index)
+    {
+        auto objects = index.GetObjects(header);
+        auto result = HandleIndexedHeader(objects, header, settings, handler);
+        if (result != ParseResult::OK)
+        {
+            return result;
+        }
+    }
+    return ParseResult::OK;
+}
+
+ParseResult APDUParser::HandleIndexedHeader(ser4cpp::rseq_t& objects,
+                                            const IndexedHeader& header,
+                                            const ParserSettings& settings,
+                                            IAPDUHandler& handler)
+{
+    const auto qualifier = header.record.GetQualifierCode();
+
+    switch (qualifier)
+    {
+    case (QualifierCode::ALL_OBJECTS):
+        return HandleAllObjectsHeader(nullptr, header.record, settings, &handler);
+
+    case (QualifierCode::UINT8_CNT):
+    case (QualifierCode::UINT16_CNT):
+        return CountParser::ParseObjects(objects, settings, header.record, header.count, nullptr, &handler);
+
+    case (QualifierCode::UINT8_START_STOP):
+    case (QualifierCode::UINT16_START_STOP):
+        return RangeParser::ParseObjects(objects, settings, header.record, header.range, nullptr, &handler);
+
+    case (QualifierCode::UINT8_CNT_UINT8_INDEX):
+    case (QualifierCode::UINT16_CNT_UINT16_INDEX):
+        return CountIndexParser::ParseObjects(objects, GetNumParser(qualifier), settings, header.record, header.count,
+                                              nullptr, &handler);
+
+    default:
+        return ParseResult::UNKNOWN_QUALIFIER;
+    }
+}
+
 ParseResult APDUParser::HandleAllObjectsHeader(Logger* pLogger,
                                                const HeaderRecord& record,
                                                const ParserSettings& settings,
@@ -20,6 +20,7 @@
 #ifndef OPENDNP3_APDUPARSER_H
 #define OPENDNP3_APDUPARSER_H
 
+#include "app/parsing/HeaderIndex.h"
 #include "app/parsing/IAPDUHandler.h"
 #include "app/parsing/NumParser.h"
 #include "app/parsing/ParseResult.h"
@@ -53,7 +54,8 @@ public:
                                        Logger* pLogger,
                                        IAPDUHandler* pHandler,
                                        IWhiteList* pWhiteList,
-                                       const ParserSettings& settings);
+                                       const ParserSettings& settings,
+                                       HeaderIndex* pIndex = nullptr);
 
 private:
     static bool AllowAll(uint32_t headerCount, GroupVariation gv, QualifierCode qc)
@@ -71,7 +73,8 @@ private:
                                    uint32_t count,
                                    const ParserSettings& settings,
                                    IAPDUHandler* pHandler,
-                                   IWhiteList* pWhiteList);
+                                   IWhiteList* pWhiteList,
+                                   HeaderIndex* pIndex);
 
     static ParseResult ParseQualifier(ser4cpp::rseq_t& buffer,
                                       Logger* pLogger,
@@ -84,6 +87,18 @@ private:
                                               const ParserSettings& settings,
                                               IAPDUHandler* pHandler);
 
+    static NumParser GetNumParser(QualifierCode qualifier);
+
+    // record a header that has been validated along with its count or range
+    static void IndexHeader(HeaderIndex& index, const HeaderRecord& record, ser4cpp::rseq_t fields);
+
+    static ParseResult HandleIndexed(const HeaderIndex& index, const ParserSettings& settings, IAPDUHandler& handler);
+
+    static ParseResult HandleIndexedHeader(ser4cpp::rseq_t& objects,
+                                           const IndexedHeader& header,
+                                           const ParserSettings& settings,
+                                           IAPDUHandler& handler);
+
     static ParseResult ParseCountOfIndices(ser4cpp::rseq_t& buffer,
                                            const HeaderRecord& record,
                                            const NumParser& numparser,
@@ -30,6 +30,20 @@ namespace opendnp3
 size_t NumBytesInBits(size_t numBits);
 bool GetBit(const ser4cpp::rseq_t& buffer, size_t position);
 
+// visit the first count bits of a buffer in order, unpacking a byte at a time
+template<class Fun> void ForeachBit(const ser4cpp::rseq_t& buffer, size_t count, const Fun& fun)
+{
+    size_t pos = 0;
+    for (size_t i = 0; pos < count; ++i)
+    {
+        const uint8_t byte = buffer[i];
+        for (uint8_t bit = 0; (bit < 8) && (pos < count); ++bit, ++pos)
+        {
+            fun((byte & (1 << bit)) != 0, pos);
+        }
+    }
+}
+
 size_t NumBytesInDoubleBits(size_t numBits);
 DoubleBit GetDoubleBit(const ser4cpp::rseq_t& buffer, size_t index);
 
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_BLOCKCOLLECTIONS_H
+#define OPENDNP3_BLOCKCOLLECTIONS_H
+
+#include "app/Range.h"
+#include "app/parsing/BitReader.h"
+#include "app/parsing/MeasurementCollection.h"
+
+#include "opendnp3/app/Indexed.h"
+
+#include <ser4cpp/container/SequenceTypes.h>
+
+namespace opendnp3
+{
+
+/**
+ * A start-stop range of fixed-size objects, decoded w/ a block decoder from BlockDecoders.h
+ *
+ * The buffer must hold the whole range.
+ */
+template<class Decoder>
+class RangeBlockCollection : public DecodedCollection<Indexed<typename Decoder::Target>, RangeBlockCollection<Decoder>>
+{
+    typedef Indexed<typename Decoder::Target> Value;
+
+public:
+    RangeBlockCollection(const ser4cpp::rseq_t& buffer, const Range& range) : data(buffer), range(range) {}
+
+    virtual size_t Count() const override final
+    {
+        return range.Count();
+    }
+
+    virtual void Foreach(IVisitor<Value>& visitor) const override final
+    {
+        this->Decode([&visitor](const Value& value, size_t) { visitor.OnValue(value); });
+    }
+
+    virtual void CopyTo(Value* dest) const override final
+    {
+        this->Decode([dest](const Value& value, size_t pos) { dest[pos] = value; });
+    }
+
+    template<class Fun> void Decode(const Fun& fun) const
+    {
+        const auto count = range.Count();
+        const auto size = Decoder::Size();
+        const uint8_t* object = data;
+
+        for (size_t pos = 0; pos < count; ++pos, object += size)
+        {
+            fun(WithIndex(Decoder::Decode(object), static_cast<uint16_t>(range.start + pos)), pos);
+        }
+    }
+
+private:
+    const uint8_t* data;
+    Range range;
+};
+
+/**
+ * A start-stop range of single bit objects, e.g. g1v1, unpacked a byte at a time
+ *
+ * The buffer must hold the whole range.
+ */
+template<class Type>
+class RangeBitfieldCollection : public DecodedCollection<Indexed<Type>, RangeBitfieldCollection<Type>>
+{
+public:
+    RangeBitfieldCollection(const ser4cpp::rseq_t& buffer, const Range& range) : buffer(buffer), range(range) {}
+
+    virtual size_t Count() const override final
+    {
+        return range.Count();
+    }
+
+    virtual void Foreach(IVisitor<Indexed<Type>>& visitor) const override final
+    {
+        const auto start = range.start;
+        ForeachBit(buffer, range.Count(), [&visitor, start](bool value, size_t pos) {
+            visitor.OnValue(WithIndex(Type(value), static_cast<uint16_t>(start + pos)));
+        });
+    }
+
+    virtual void CopyTo(Indexed<Type>* dest) const override final
+    {
+        this->Decode([dest](const Indexed<Type>& value, size_t pos) { dest[pos] = value; });
+    }
+
+    template<class Fun> void Decode(const Fun& fun) const
+    {
+        const auto start = range.start;
+        ForeachBit(buffer, range.Count(), [&fun, start](bool value, size_t pos) {
+            fun(WithIndex(Type(value), static_cast<uint16_t>(start + pos)), pos);
+        });
+    }
+
+private:
+    ser4cpp::rseq_t buffer;
+    Range range;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_BLOCKDECODERS_H
+#define OPENDNP3_BLOCKDECODERS_H
+
+#include "opendnp3/app/Flags.h"
+
+#include <ser4cpp/serialization/LittleEndian.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace opendnp3
+{
+
+/**
+ * Decoders for fixed-size objects that are read as a block, e.g. a start-stop range of static values.
+ *
+ * The generated Read/ReadTarget functions check the remaining length of the buffer for every field. A block
+ * decoder reads straight from the encoded object instead, which is only safe after the size of the whole
+ * block has been checked. The objects are decoded to exactly the same values as the generated functions produce.
+ */
+
+inline uint16_t LoadUInt16(const uint8_t* data)
+{
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+inline uint32_t LoadUInt32(const uint8_t* data)
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8)
+        | (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+template<class T> T LoadValue(const uint8_t* data);
+
+template<> inline uint16_t LoadValue(const uint8_t* data)
+{
+    return LoadUInt16(data);
+}
+
+template<> inline int16_t LoadValue(const uint8_t* data)
+{
+    return static_cast<int16_t>(LoadUInt16(data));
+}
+
+template<> inline uint32_t LoadValue(const uint8_t* data)
+{
+    return LoadUInt32(data);
+}
+
+template<> inline int32_t LoadValue(const uint8_t* data)
+{
+    return static_cast<int32_t>(LoadUInt32(data));
+}
+
+template<> inline float LoadValue(const uint8_t* data)
+{
+    return ser4cpp::SingleFloat::to_float32(LoadUInt32(data));
+}
+
+// objects that consist of a single flags byte, e.g. g1v2
+template<class Descriptor> struct FlagsBlockDecoder
+{
+    typedef typename Descriptor::Target Target;
+
+    static size_t Size()
+    {
+        return Descriptor::Size();
+    }
+
+    static Target Decode(const uint8_t* data)
+    {
+        return Target(Flags(data[0]));
+    }
+};
+
+// objects that consist of a flags byte followed by a little endian value, e.g. g30v1
+template<class Descriptor> struct FlagsAndValueBlockDecoder
+{
+    typedef typename Descriptor::Target Target;
+
+    static size_t Size()
+    {
+        return Descriptor::Size();
+    }
+
+    static Target Decode(const uint8_t* data)
+    {
+        return Target(LoadValue<typename Descriptor::ValueType>(data + 1), Flags(data[0]));
+    }
+};
+
+} // namespace opendnp3
+
+#endif
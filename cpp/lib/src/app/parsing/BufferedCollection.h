@@ -20,14 +20,15 @@
 #ifndef OPENDNP3_BUFFEREDCOLLECTION_H
 #define OPENDNP3_BUFFEREDCOLLECTION_H
 
-#include "opendnp3/app/parsing/ICollection.h"
+#include "app/parsing/MeasurementCollection.h"
 
 #include <ser4cpp/container/SequenceTypes.h>
 
 namespace opendnp3
 {
 
-template<class T, class ReadFunc> class BufferedCollection : public ICollection<T>
+template<class T, class ReadFunc>
+class BufferedCollection : public DecodedCollection<T, BufferedCollection<T, ReadFunc>>
 {
 public:
     BufferedCollection(const ser4cpp::rseq_t& buffer, size_t count, const ReadFunc& readFunc)
@@ -50,6 +51,21 @@ public:
         }
     }
 
+    virtual void CopyTo(T* dest) const final
+    {
+        this->Decode([dest](const T& value, size_t pos) { dest[pos] = value; });
+    }
+
+    template<class Fun> void Decode(const Fun& fun) const
+    {
+        ser4cpp::rseq_t copy(buffer);
+
+        for (uint32_t pos = 0; pos < COUNT; ++pos)
+        {
+            fun(readFunc(copy, pos), pos);
+        }
+    }
+
 private:
     ser4cpp::rseq_t buffer;
     const size_t COUNT;
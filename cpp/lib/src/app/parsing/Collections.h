@@ -20,9 +20,13 @@
 #ifndef OPENDNP3_COLLECTIONS_H
 #define OPENDNP3_COLLECTIONS_H
 
+#include "app/parsing/MeasurementCollection.h"
+
 #include "opendnp3/app/parsing/ICollection.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <type_traits>
 
 namespace opendnp3
 {
@@ -30,7 +34,7 @@ namespace opendnp3
 /**
  * A simple collection derived from an underlying array
  */
-template<class T> class ArrayCollection : public ICollection<T>
+template<class T> class ArrayCollection : public DecodedCollection<T, ArrayCollection<T>>
 {
 public:
     ArrayCollection(const T* pArray_, size_t count) : pArray(pArray_), COUNT(count) {}
@@ -48,6 +52,19 @@ public:
         }
     }
 
+    virtual void CopyTo(T* dest) const override final
+    {
+        std::copy(pArray, pArray + COUNT, dest);
+    }
+
+    template<class Fun> void Decode(const Fun& fun) const
+    {
+        for (size_t pos = 0; pos < COUNT; ++pos)
+        {
+            fun(pArray[pos], pos);
+        }
+    }
+
 private:
     const T* pArray;
     const size_t COUNT;
@@ -69,7 +86,28 @@ public:
         input->ForeachItem(process);
     }
 
+    virtual void CopyTo(U* dest) const override final
+    {
+        this->CopyTransformed(dest, std::is_same<T, U>());
+    }
+
 private:
+    // transformations that don't change the type are applied in place after a bulk copy of the input
+    void CopyTransformed(U* dest, std::true_type) const
+    {
+        input->CopyTo(dest);
+        const auto count = input->Count();
+        for (size_t i = 0; i < count; ++i)
+        {
+            dest[i] = transform(dest[i]);
+        }
+    }
+
+    void CopyTransformed(U* dest, std::false_type) const
+    {
+        ICollection<U>::CopyTo(dest);
+    }
+
     const ICollection<T>* input;
     Transform transform;
 };
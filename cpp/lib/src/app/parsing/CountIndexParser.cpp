@@ -56,19 +56,30 @@ ParseResult CountIndexParser::ParseHeader(ser4cpp::rseq_t& buffer,
                             GroupVariationSpec::to_human_string(record.enumeration),
                             QualifierCodeSpec::to_human_string(record.GetQualifierCode()), count);
 
-        if (settings.ExpectsContents())
-        {
-            return ParseCountOfObjects(buffer, record, numparser, count, pLogger, pHandler);
-        }
-        else
-        {
-            return ParseCountOfIndices(buffer, record, numparser, count, pLogger, pHandler);
-        }
+        return ParseObjects(buffer, numparser, settings, record, count, pLogger, pHandler);
     }
 
     return res;
 }
 
+ParseResult CountIndexParser::ParseObjects(ser4cpp::rseq_t& buffer,
+                                           const NumParser& numparser,
+                                           const ParserSettings& settings,
+                                           const HeaderRecord& record,
+                                           uint16_t count,
+                                           Logger* pLogger,
+                                           IAPDUHandler* pHandler)
+{
+    if (settings.ExpectsContents())
+    {
+        return ParseCountOfObjects(buffer, record, numparser, count, pLogger, pHandler);
+    }
+    else
+    {
+        return ParseCountOfIndices(buffer, record, numparser, count, pLogger, pHandler);
+    }
+}
+
 ParseResult CountIndexParser::Process(const HeaderRecord& record,
                                       ser4cpp::rseq_t& buffer,
                                       IAPDUHandler* pHandler,
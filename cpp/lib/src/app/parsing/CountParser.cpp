@@ -65,17 +65,7 @@ ParseResult CountParser::ParseHeader(ser4cpp::rseq_t& buffer,
                             GroupVariationSpec::to_human_string(record.enumeration),
                             QualifierCodeSpec::to_human_string(record.GetQualifierCode()), count);
 
-        if (settings.ExpectsContents())
-        {
-            return ParseCountOfObjects(buffer, record, count, pLogger, pHandler);
-        }
-
-        if (pHandler)
-        {
-            pHandler->OnHeader(CountHeader(record, count));
-        }
-
-        return ParseResult::OK;
+        return ParseObjects(buffer, settings, record, count, pLogger, pHandler);
     }
     else
     {
@@ -83,6 +73,26 @@ ParseResult CountParser::ParseHeader(ser4cpp::rseq_t& buffer,
     }
 }
 
+ParseResult CountParser::ParseObjects(ser4cpp::rseq_t& buffer,
+                                      const ParserSettings& settings,
+                                      const HeaderRecord& record,
+                                      uint16_t count,
+                                      Logger* pLogger,
+                                      IAPDUHandler* pHandler)
+{
+    if (settings.ExpectsContents())
+    {
+        return ParseCountOfObjects(buffer, record, count, pLogger, pHandler);
+    }
+
+    if (pHandler)
+    {
+        pHandler->OnHeader(CountHeader(record, count));
+    }
+
+    return ParseResult::OK;
+}
+
 ParseResult CountParser::ParseCountOfObjects(
     ser4cpp::rseq_t& buffer, const HeaderRecord& record, uint16_t count, Logger* pLogger, IAPDUHandler* pHandler)
 {
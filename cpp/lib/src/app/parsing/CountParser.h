@@ -49,6 +49,14 @@ public:
                                    Logger* pLogger,
                                    IAPDUHandler* pHandler);
 
+    // Handle the objects that follow a count that has already been parsed
+    static ParseResult ParseObjects(ser4cpp::rseq_t& buffer,
+                                    const ParserSettings& settings,
+                                    const HeaderRecord& record,
+                                    uint16_t count,
+                                    Logger* pLogger,
+                                    IAPDUHandler* pHandler);
+
 private:
     // Process the count handler against the buffer
     ParseResult Process(const HeaderRecord& record,
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_HEADERINDEX_H
+#define OPENDNP3_HEADERINDEX_H
+
+#include "app/GroupVariationRecord.h"
+#include "app/Range.h"
+
+#include <ser4cpp/container/SequenceTypes.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace opendnp3
+{
+
+// What the validating pass of the APDUParser learned about a single object header
+struct IndexedHeader
+{
+    HeaderRecord record;
+
+    // offset of the objects from the start of the APDU object data
+    uint32_t offset = 0;
+
+    // only meaningful for the count based qualifiers
+    uint16_t count = 0;
+
+    // only meaningful for the start-stop qualifiers
+    Range range;
+};
+
+// entries are never destroyed
+static_assert(std::is_trivially_destructible<IndexedHeader>::value, "IndexedHeader must be trivially destructible");
+
+/**
+ * A fixed capacity list of the headers in an APDU. Fragments rarely carry more than a handful of headers, so the
+ * index lives on the stack and is simply marked incomplete if an APDU has more headers than it can hold.
+ */
+class HeaderIndex
+{
+public:
+    static const uint32_t max_headers = 32;
+
+    explicit HeaderIndex(const ser4cpp::rseq_t& objects) : objects(objects) {}
+
+    // @param remainder the part of the indexed object data that starts with the objects of the header
+    // @return the entry for the next header, or nullptr if the index is full
+    IndexedHeader* Add(const HeaderRecord& record, const ser4cpp::rseq_t& remainder)
+    {
+        if (this->num_headers == max_headers)
+        {
+            this->complete = false;
+            return nullptr;
+        }
+
+        auto header = new (&this->storage[this->num_headers++]) IndexedHeader();
+        header->record = record;
+        header->offset = static_cast<uint32_t>(this->objects.length() - remainder.length());
+        return header;
+    }
+
+    // @return the object data from the start of the objects of an indexed header
+    ser4cpp::rseq_t GetObjects(const IndexedHeader& header) const
+    {
+        return this->objects.skip(header.offset);
+    }
+
+    bool IsComplete() const
+    {
+        return this->complete;
+    }
+
+    uint32_t Size() const
+    {
+        return this->num_headers;
+    }
+
+    const IndexedHeader* begin() const
+    {
+        return reinterpret_cast<const IndexedHeader*>(this->storage);
+    }
+
+    const IndexedHeader* end() const
+    {
+        return this->begin() + this->num_headers;
+    }
+
+private:
+    const ser4cpp::rseq_t objects;
+
+    // entries are only constructed as headers are added, an index is created for every APDU that is parsed
+    typename std::aligned_storage<sizeof(IndexedHeader), alignof(IndexedHeader)>::type storage[max_headers];
+    uint32_t num_headers = 0;
+    bool complete = true;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_MEASUREMENTCOLLECTION_H
+#define OPENDNP3_MEASUREMENTCOLLECTION_H
+
+#include "opendnp3/app/DNPTime.h"
+#include "opendnp3/app/Indexed.h"
+#include "opendnp3/app/MeasurementTypes.h"
+#include "opendnp3/app/parsing/ICollection.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace opendnp3
+{
+
+/**
+ * Parallel arrays that a collection of indexed measurements w/ a single value is decoded into, one element per
+ * item. The times are skipped if the array is null.
+ */
+template<class T> class MeasurementColumns
+{
+public:
+    MeasurementColumns(uint16_t* indices, typename T::Type* values, uint8_t* flags, DNPTime* times)
+        : indices(indices), values(values), flags(flags), times(times)
+    {
+    }
+
+    void Set(size_t pos, const Indexed<T>& item) const
+    {
+        this->indices[pos] = item.index;
+        this->values[pos] = item.value.value;
+        this->flags[pos] = item.value.flags.value;
+        if (this->times)
+        {
+            this->times[pos] = item.value.time;
+        }
+    }
+
+    uint16_t* const indices;
+    typename T::Type* const values;
+    uint8_t* const flags;
+    DNPTime* const times;
+};
+
+/**
+ * A collection of indexed measurements that can be decoded straight into columns
+ */
+template<class T> class IMeasurementCollection : public ICollection<Indexed<T>>
+{
+public:
+    using ICollection<Indexed<T>>::CopyTo;
+
+    /**
+     * Decode all the elements into columns that can each hold at least Count() elements
+     */
+    virtual void CopyTo(const MeasurementColumns<T>& dest) const = 0;
+};
+
+template<class T> struct HasColumns : std::false_type
+{
+};
+
+template<> struct HasColumns<Indexed<Binary>> : std::true_type
+{
+};
+template<> struct HasColumns<Indexed<DoubleBitBinary>> : std::true_type
+{
+};
+template<> struct HasColumns<Indexed<Analog>> : std::true_type
+{
+};
+template<> struct HasColumns<Indexed<Counter>> : std::true_type
+{
+};
+template<> struct HasColumns<Indexed<FrozenCounter>> : std::true_type
+{
+};
+template<> struct HasColumns<Indexed<BinaryOutputStatus>> : std::true_type
+{
+};
+template<> struct HasColumns<Indexed<AnalogOutputStatus>> : std::true_type
+{
+};
+
+/**
+ * Base of the collections that decode their elements in a loop, which implements IMeasurementCollection
+ * for the measurement types w/ columns
+ *
+ * The derived collection provides Decode(fun), calling fun(item, pos) for every element.
+ */
+template<class T, class Derived, bool = HasColumns<T>::value> class DecodedCollection : public ICollection<T>
+{
+};
+
+template<class T, class Derived>
+class DecodedCollection<Indexed<T>, Derived, true> : public IMeasurementCollection<T>
+{
+public:
+    virtual void CopyTo(const MeasurementColumns<T>& dest) const override final
+    {
+        static_cast<const Derived*>(this)->Decode([&dest](const Indexed<T>& item, size_t pos) { dest.Set(pos, item); });
+    }
+};
+
+} // namespace opendnp3
+
+#endif
@@ -56,6 +56,16 @@ ParseResult RangeParser::ParseHeader(ser4cpp::rseq_t& buffer,
                         GroupVariationSpec::to_human_string(record.enumeration),
                         QualifierCodeSpec::to_human_string(record.GetQualifierCode()), range.start, range.stop);
 
+    return ParseObjects(buffer, settings, record, range, pLogger, pHandler);
+}
+
+ParseResult RangeParser::ParseObjects(ser4cpp::rseq_t& buffer,
+                                      const ParserSettings& settings,
+                                      const HeaderRecord& record,
+                                      const Range& range,
+                                      Logger* pLogger,
+                                      IAPDUHandler* pHandler)
+{
     if (settings.ExpectsContents())
     {
         return ParseRangeOfObjects(buffer, record, range, pLogger, pHandler);
@@ -91,6 +101,10 @@ ParseResult RangeParser::Process(const HeaderRecord& record,
     case (GroupVariation::descriptor):                                                                                 \
         return RangeParser::FromFixedSize<descriptor>(range).Process(record, buffer, pHandler, pLogger);
 
+#define MACRO_PARSE_BLOCK_WITH_RANGE(descriptor, decoder)                                                              \
+    case (GroupVariation::descriptor):                                                                                 \
+        return RangeParser::FromBlockDecoder<decoder<descriptor>>(range).Process(record, buffer, pHandler, pLogger);
+
 ParseResult RangeParser::ParseRangeOfObjects(
     ser4cpp::rseq_t& buffer, const HeaderRecord& record, const Range& range, Logger* pLogger, IAPDUHandler* pHandler)
 {
@@ -99,7 +113,7 @@ ParseResult RangeParser::ParseRangeOfObjects(
     case (GroupVariation::Group1Var1):
         return RangeParser::FromBitfieldType<Binary>(range).Process(record, buffer, pHandler, pLogger);
 
-        MACRO_PARSE_OBJECTS_WITH_RANGE(Group1Var2);
+        MACRO_PARSE_BLOCK_WITH_RANGE(Group1Var2, FlagsBlockDecoder);
 
     case (GroupVariation::Group3Var1):
         return RangeParser::FromDoubleBitfieldType<DoubleBitBinary>(range).Process(record, buffer, pHandler, pLogger);
@@ -107,10 +121,10 @@ ParseResult RangeParser::ParseRangeOfObjects(
         return RangeParser::FromBitfieldType<BinaryOutputStatus>(range).Process(record, buffer, pHandler, pLogger);
 
         MACRO_PARSE_OBJECTS_WITH_RANGE(Group3Var2);
-        MACRO_PARSE_OBJECTS_WITH_RANGE(Group10Var2);
+        MACRO_PARSE_BLOCK_WITH_RANGE(Group10Var2, FlagsBlockDecoder);
 
-        MACRO_PARSE_OBJECTS_WITH_RANGE(Group20Var1);
-        MACRO_PARSE_OBJECTS_WITH_RANGE(Group20Var2);
+        MACRO_PARSE_BLOCK_WITH_RANGE(Group20Var1, FlagsAndValueBlockDecoder);
+        MACRO_PARSE_BLOCK_WITH_RANGE(Group20Var2, FlagsAndValueBlockDecoder);
         MACRO_PARSE_OBJECTS_WITH_RANGE(Group20Var5);
         MACRO_PARSE_OBJECTS_WITH_RANGE(Group20Var6);
 
@@ -121,11 +135,11 @@ ParseResult RangeParser::ParseRangeOfObjects(
         MACRO_PARSE_OBJECTS_WITH_RANGE(Group21Var9);
         MACRO_PARSE_OBJECTS_WITH_RANGE(Group21Var10);
 
-        MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var1);
-        MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var2);
+        MACRO_PARSE_BLOCK_WITH_RANGE(Group30Var1, FlagsAndValueBlockDecoder);
+        MACRO_PARSE_BLOCK_WITH_RANGE(Group30Var2, FlagsAndValueBlockDecoder);
         MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var3);
         MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var4);
-        MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var5);
+        MACRO_PARSE_BLOCK_WITH_RANGE(Group30Var5, FlagsAndValueBlockDecoder);
         MACRO_PARSE_OBJECTS_WITH_RANGE(Group30Var6);
 
         MACRO_PARSE_OBJECTS_WITH_RANGE(Group40Var1);
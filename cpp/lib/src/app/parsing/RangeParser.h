@@ -22,6 +22,8 @@
 
 #include "app/Range.h"
 #include "app/parsing/BitReader.h"
+#include "app/parsing/BlockCollections.h"
+#include "app/parsing/BlockDecoders.h"
 #include "app/parsing/BufferedCollection.h"
 #include "app/parsing/IAPDUHandler.h"
 #include "app/parsing/NumParser.h"
@@ -50,6 +52,14 @@ public:
                                    Logger* pLogger,
                                    IAPDUHandler* pHandler);
 
+    // Handle the objects that follow a range that has already been parsed
+    static ParseResult ParseObjects(ser4cpp::rseq_t& buffer,
+                                    const ParserSettings& settings,
+                                    const HeaderRecord& record,
+                                    const Range& range,
+                                    Logger* pLogger,
+                                    IAPDUHandler* pHandler);
+
 private:
     // Process the range against the buffer
     ParseResult Process(const HeaderRecord& record,
@@ -62,6 +72,9 @@ private:
 
     template<class Type> static RangeParser FromFixedSizeType(const Range& range);
 
+    // Create a range parser that decodes the whole range w/ a block decoder
+    template<class Decoder> static RangeParser FromBlockDecoder(const Range& range);
+
     // Create a range parser from a bitfield and a function to map the bitfield to values
     template<class Type> static RangeParser FromBitfieldType(const Range& range);
 
@@ -85,6 +98,12 @@ private:
                               const ser4cpp::rseq_t& buffer,
                               IAPDUHandler& handler);
 
+    template<class Decoder>
+    static void InvokeRangeOfBlock(const HeaderRecord& record,
+                                   const Range& range,
+                                   const ser4cpp::rseq_t& buffer,
+                                   IAPDUHandler& handler);
+
     template<class Type>
     static void InvokeRangeOfType(const HeaderRecord& record,
                                   const Range& range,
@@ -124,6 +143,12 @@ template<class Type> RangeParser RangeParser::FromFixedSizeType(const Range& ran
     return RangeParser(range, size, &InvokeRangeOfType<Type>);
 }
 
+template<class Decoder> RangeParser RangeParser::FromBlockDecoder(const Range& range)
+{
+    const auto size = range.Count() * Decoder::Size();
+    return RangeParser(range, size, &InvokeRangeOfBlock<Decoder>);
+}
+
 template<class Descriptor>
 void RangeParser::InvokeRangeOf(const HeaderRecord& record,
                                 const Range& range,
@@ -143,6 +168,17 @@ void RangeParser::InvokeRangeOf(const HeaderRecord& record,
     handler.OnHeader(RangeHeader(record, range), collection);
 }
 
+template<class Decoder>
+void RangeParser::InvokeRangeOfBlock(const HeaderRecord& record,
+                                     const Range& range,
+                                     const ser4cpp::rseq_t& buffer,
+                                     IAPDUHandler& handler)
+{
+    RangeBlockCollection<Decoder> collection(buffer, range);
+
+    handler.OnHeader(RangeHeader(record, range), collection);
+}
+
 template<class Type>
 void RangeParser::InvokeRangeOfType(const HeaderRecord& record,
                                     const Range& range,
@@ -174,14 +210,7 @@ void RangeParser::InvokeRangeBitfieldType(const HeaderRecord& record,
                                           const ser4cpp::rseq_t& buffer,
                                           IAPDUHandler& handler)
 {
-    const auto COUNT = range.Count();
-
-    auto read = [range](ser4cpp::rseq_t& buffer, uint32_t pos) -> Indexed<Type> {
-        Type value(GetBit(buffer, pos));
-        return WithIndex(value, range.start + pos);
-    };
-
-    auto collection = CreateBufferedCollection<Indexed<Type>>(buffer, COUNT, read);
+    RangeBitfieldCollection<Type> collection(buffer, range);
 
     handler.OnHeader(RangeHeader(record, range), collection);
 }
@@ -29,8 +29,11 @@
 namespace opendnp3
 {
 
-IOHandler::IOHandler(const Logger& logger, bool close_existing, std::shared_ptr<IChannelListener> listener)
-    : close_existing(close_existing), logger(logger), listener(std::move(listener)), parser(logger)
+IOHandler::IOHandler(const Logger& logger,
+                     bool close_existing,
+                     std::shared_ptr<IChannelListener> listener,
+                     size_t rxBufferSize)
+    : close_existing(close_existing), logger(logger), listener(std::move(listener)), parser(logger, rxBufferSize)
 {
 }
 
@@ -83,10 +86,10 @@ void IOHandler::OnWriteComplete(const ASIO_ERROR& ec, size_t num)
     {
         this->statistics.numBytesTx += num;
 
-        if (!this->txQueue.empty())
+        if (this->activeTx.is_set())
         {
-            const auto session = this->txQueue.front().session;
-            this->txQueue.pop_front();
+            const auto session = this->activeTx.get().session;
+            this->activeTx.clear();
             session->OnTxReady();
         }
 
@@ -98,8 +101,25 @@ void IOHandler::BeginTransmit(const std::shared_ptr<ILinkSession>& session, cons
 {
     if (this->channel)
     {
-        this->txQueue.emplace_back(data, session);
+        Transmission tx(data, session);
+
+        if (tx.IsSecondary())
+        {
+            this->priorityQueue.push_back(tx);
+        }
+        else
+        {
+            this->txQueue.push_back(tx);
+        }
+
         this->CheckForSend();
+
+        // transmissions that went straight to the channel never waited in a queue
+        const auto depth = this->priorityQueue.size() + this->txQueue.size();
+        if (depth > this->statistics.maxTxQueueDepth)
+        {
+            this->statistics.maxTxQueueDepth = depth;
+        }
     }
     else
     {
@@ -122,23 +142,25 @@ bool IOHandler::AddContext(const std::shared_ptr<ILinkSession>& session, const A
     }
 
     sessions.emplace_back(session, addresses); // record is always disabled by default
+    this->UpdateRoutes();
 
     return true;
 }
 
 bool IOHandler::Enable(const std::shared_ptr<ILinkSession>& session)
 {
-    auto matches = [&](const Session& rec) { return rec.Matches(session); };
+    const auto index = this->sessionsByPointer.find(session.get());
 
-    const auto iter = std::find_if(sessions.begin(), sessions.end(), matches);
-
-    if (iter == sessions.end())
+    if (index == this->sessionsByPointer.end())
         return false;
 
+    const auto iter = this->sessions.begin() + index->second;
+
     if (iter->enabled)
         return true; // already enabled
 
     iter->enabled = true;
+    this->UpdateRoutes();
 
     if (this->channel)
     {
@@ -156,17 +178,18 @@ bool IOHandler::Enable(const std::shared_ptr<ILinkSession>& session)
 
 bool IOHandler::Disable(const std::shared_ptr<ILinkSession>& session)
 {
-    auto matches = [&](const Session& rec) { return rec.Matches(session); };
+    const auto index = this->sessionsByPointer.find(session.get());
 
-    const auto iter = std::find_if(sessions.begin(), sessions.end(), matches);
-
-    if (iter == sessions.end())
+    if (index == this->sessionsByPointer.end())
         return false;
 
+    const auto iter = this->sessions.begin() + index->second;
+
     if (!iter->enabled)
         return true; // already disabled
 
     iter->enabled = false;
+    this->UpdateRoutes();
 
     if (channel)
     {
@@ -184,19 +207,20 @@ bool IOHandler::Disable(const std::shared_ptr<ILinkSession>& session)
 
 bool IOHandler::Remove(const std::shared_ptr<ILinkSession>& session)
 {
-    auto matches = [&](const Session& rec) { return rec.Matches(session); };
-
-    const auto iter = std::find_if(sessions.begin(), sessions.end(), matches);
+    const auto index = this->sessionsByPointer.find(session.get());
 
-    if (iter == sessions.end())
+    if (index == this->sessionsByPointer.end())
         return false;
 
+    const auto iter = this->sessions.begin() + index->second;
+
     if (channel)
     {
         iter->LowerLayerDown();
     }
 
     sessions.erase(iter);
+    this->UpdateRoutes();
 
     if (!this->IsAnySessionEnabled())
     {
@@ -250,6 +274,20 @@ bool IOHandler::OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& u
     return false;
 }
 
+ser4cpp::wseq_t IOHandler::GetUserDataBuffer(const LinkHeaderFields& header, size_t length)
+{
+    // only a frame addressed to exactly one session's route can be written into that session,
+    // the data of broadcasts and unrouted frames stays in the parser
+    const auto index = this->sessionsByRoute.find(GetRouteKey(header.addresses));
+
+    if (index == this->sessionsByRoute.end() || !this->sessions[index->second].enabled)
+    {
+        return ser4cpp::wseq_t::empty();
+    }
+
+    return this->sessions[index->second].GetUserDataBuffer(header, length);
+}
+
 void IOHandler::BeginRead()
 {
     this->channel->BeginRead(this->parser.WriteBuff());
@@ -257,49 +295,104 @@ void IOHandler::BeginRead()
 
 void IOHandler::CheckForSend()
 {
-    if (this->txQueue.empty() || !this->channel || !this->channel->CanWrite())
+    if (this->activeTx.is_set() || !this->channel || !this->channel->CanWrite())
+        return;
+
+    Transmission tx;
+    if (!this->PopNextTransmission(tx))
         return;
 
-    ++statistics.numLinkFrameTx;
-    this->channel->BeginWrite(this->txQueue.front().txdata);
+    // a transmission may contain several pre-formatted frames
+    statistics.numLinkFrameTx += LinkFrame::CountFrames(tx.txdata);
+    this->activeTx.set(tx);
+    this->channel->BeginWrite(tx.txdata);
+}
+
+bool IOHandler::PopNextTransmission(Transmission& tx)
+{
+    if (!this->priorityQueue.empty())
+    {
+        if (!this->txQueue.empty())
+        {
+            ++this->statistics.numPriorityTx;
+        }
+
+        tx = this->priorityQueue.front();
+        this->priorityQueue.pop_front();
+        return true;
+    }
+
+    if (this->txQueue.empty())
+        return false;
+
+    tx = this->txQueue.front();
+    this->txQueue.pop_front();
+    return true;
 }
 
-bool IOHandler::SendToSession(const Addresses& /*addresses*/,
+bool IOHandler::SendToSession(const Addresses& addresses,
                               const LinkHeaderFields& header,
                               const ser4cpp::rseq_t& userdata)
 {
-    bool accepted = false;
+    // frames go to the sessions with a matching local address, which still check the source address. Broadcasts go
+    // to every enabled session, as do frames for an unknown destination so that the sessions can report it.
+    const std::vector<size_t>* targets = &this->enabledSessions;
 
-    for (auto& session : sessions)
+    if (!addresses.IsBroadcast())
     {
-        if (session.enabled)
+        const auto iter = this->enabledByDestination.find(addresses.destination);
+        if (iter != this->enabledByDestination.end())
         {
-            accepted |= session.OnFrame(header, userdata);
+            targets = &iter->second;
         }
     }
 
+    bool accepted = false;
+
+    for (const auto index : *targets)
+    {
+        accepted |= this->sessions[index].OnFrame(header, userdata);
+    }
+
     return accepted;
 }
 
 bool IOHandler::IsRouteInUse(const Addresses& addresses) const
 {
-    auto matches = [addresses](const Session& record) { return record.Matches(addresses); };
-
-    return std::find_if(sessions.begin(), sessions.end(), matches) != sessions.end();
+    return this->sessionsByRoute.find(GetRouteKey(addresses)) != this->sessionsByRoute.end();
 }
 
 bool IOHandler::IsSessionInUse(const std::shared_ptr<ILinkSession>& session) const
 {
-    auto matches = [&](const Session& record) { return record.Matches(session); };
-
-    return std::find_if(sessions.begin(), sessions.end(), matches) != sessions.end();
+    return this->sessionsByPointer.find(session.get()) != this->sessionsByPointer.end();
 }
 
 bool IOHandler::IsAnySessionEnabled() const
 {
-    auto matches = [&](const Session& record) { return record.enabled; };
+    return !this->enabledSessions.empty();
+}
+
+void IOHandler::UpdateRoutes()
+{
+    this->sessionsByPointer.clear();
+    this->sessionsByRoute.clear();
+    this->enabledByDestination.clear();
+    this->enabledSessions.clear();
 
-    return std::find_if(sessions.begin(), sessions.end(), matches) != sessions.end();
+    for (size_t i = 0; i < this->sessions.size(); ++i)
+    {
+        const auto& session = this->sessions[i];
+
+        this->sessionsByPointer[session.GetSession()] = i;
+        this->sessionsByRoute[GetRouteKey(session.GetAddresses())] = i;
+
+        if (session.enabled)
+        {
+            // routes are stored from the remote address to the local address
+            this->enabledByDestination[session.GetAddresses().destination].push_back(i);
+            this->enabledSessions.push_back(i);
+        }
+    }
 }
 
 void IOHandler::Reset()
@@ -325,6 +418,8 @@ void IOHandler::Reset()
     this->parser.Reset();
 
     // clear any pending tranmissions
+    this->activeTx.clear();
+    this->priorityQueue.clear();
     this->txQueue.clear();
 }
 
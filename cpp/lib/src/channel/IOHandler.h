@@ -22,13 +22,17 @@
 
 #include "channel/IAsyncChannel.h"
 #include "link/ILinkTx.h"
+#include "link/LinkLayerConstants.h"
 #include "link/LinkLayerParser.h"
 
 #include "opendnp3/channel/IChannelListener.h"
 #include "opendnp3/link/Addresses.h"
 #include "opendnp3/logging/Logger.h"
 
+#include <ser4cpp/container/Settable.h>
+
 #include <deque>
+#include <unordered_map>
 #include <vector>
 
 namespace opendnp3
@@ -43,7 +47,10 @@ class IOHandler : private IFrameSink, public IChannelCallbacks, public std::enab
 {
 
 public:
-    IOHandler(const Logger& logger, bool close_existing, std::shared_ptr<IChannelListener> listener);
+    IOHandler(const Logger& logger,
+              bool close_existing,
+              std::shared_ptr<IChannelListener> listener,
+              size_t rxBufferSize = LINK_DEFAULT_RX_BUFFER_SIZE);
 
     virtual ~IOHandler() = default;
 
@@ -114,8 +121,12 @@ private:
     // called by the parser when a complete frame is read
     bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) final;
 
+    // called by the parser before it de-CRCs the user data of a frame
+    ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) final;
+
     bool IsSessionInUse(const std::shared_ptr<ILinkSession>& session) const;
     bool IsAnySessionEnabled() const;
+    void UpdateRoutes();
     void Reset();
     void BeginRead();
     void CheckForSend();
@@ -142,11 +153,26 @@ private:
             return this->addresses == addresses;
         }
 
+        inline const Addresses& GetAddresses() const
+        {
+            return this->addresses;
+        }
+
+        inline const ILinkSession* GetSession() const
+        {
+            return this->session.get();
+        }
+
         inline bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata)
         {
             return this->session->OnFrame(header, userdata);
         }
 
+        inline ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length)
+        {
+            return this->session->GetUserDataBuffer(header, length);
+        }
+
         inline bool LowerLayerUp()
         {
             if (!online)
@@ -190,13 +216,41 @@ private:
 
         Transmission() = default;
 
+        // secondary frames (ACK, NACK, LINK_STATUS, ...) have the PRM bit cleared
+        inline bool IsSecondary() const
+        {
+            return (this->txdata.length() > LI_CONTROL) && ((this->txdata[LI_CONTROL] & MASK_PRM) == 0);
+        }
+
         ser4cpp::rseq_t txdata;
         std::shared_ptr<ILinkSession> session;
     };
 
+    bool PopNextTransmission(Transmission& tx);
+
+    static inline uint32_t GetRouteKey(const Addresses& addresses)
+    {
+        return (static_cast<uint32_t>(addresses.source) << 16) | addresses.destination;
+    }
+
     std::vector<Session> sessions;
+
+    // the transmission being written to the channel, if any
+    ser4cpp::Settable<Transmission> activeTx;
+
+    // secondary frames are written ahead of any primary data so that a session streaming a large
+    // response cannot delay the acknowledgements and link status replies of the other sessions
+    std::deque<Transmission> priorityQueue;
+
+    // each session has at most one primary transmission outstanding, so a single FIFO already serves them in turn
     std::deque<Transmission> txQueue;
 
+    // indexes into sessions, rebuilt whenever a session is added, removed, enabled or disabled
+    std::unordered_map<const ILinkSession*, size_t> sessionsByPointer;
+    std::unordered_map<uint32_t, size_t> sessionsByRoute;
+    std::unordered_map<uint16_t, std::vector<size_t>> enabledByDestination;
+    std::vector<size_t> enabledSessions;
+
     LinkLayerParser parser;
 
     // current value of the channel, may be empty
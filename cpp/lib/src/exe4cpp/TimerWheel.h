@@ -0,0 +1,530 @@
+/*
+ * Copyright (c) 2018, Automatak LLC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ * disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+ * disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote
+ * products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef EXE4CPP_TIMERWHEEL_H
+#define EXE4CPP_TIMERWHEEL_H
+
+#include "exe4cpp/ITimer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+
+namespace exe4cpp
+{
+
+/**
+ * Hierarchical timer wheel with millisecond ticks
+ *
+ * Starting and canceling a timer are O(1) list operations. The owner drives the wheel with a single
+ * underlying timer: the wheel asks for it to be armed at the next tick where work is due, and calls
+ * expire() from that timer. Timers never expire before their expiration time, and timers due at the same tick
+ * run in the order they were started. A timer started by an action that is already due runs on the next call
+ * to expire(), so an action re-arming itself at the current time can't starve the owner.
+ *
+ * Not thread-safe, all calls including the cancellation of timers must be made from the same context.
+ */
+class TimerWheel final
+{
+public:
+    using arm_t = std::function<void(const steady_time_t&)>;
+
+private:
+    using tick_t = uint64_t;
+    using resolution_t = std::chrono::milliseconds;
+
+    static constexpr uint32_t bits_per_level = 6;
+    static constexpr uint32_t num_levels = 4;
+    static constexpr uint32_t slots_per_level = 1u << bits_per_level;
+    static constexpr tick_t slot_mask = slots_per_level - 1;
+    // timers beyond the range of the levels (~4.6 hours) wait in a list until their range comes up
+    static constexpr uint8_t overflow_level = num_levels;
+    static constexpr uint32_t overflow_shift = bits_per_level * num_levels;
+    // the timers of the slot being processed, detached so that timers started by their actions wait for the next pass
+    static constexpr uint8_t expiring_level = num_levels + 1;
+
+    class WheelTimer final : public ITimer
+    {
+        friend class TimerWheel;
+
+    public:
+        WheelTimer(TimerWheel* wheel, const steady_time_t& expiration, tick_t tick, const action_t& action) :
+            wheel{wheel},
+            expiration{expiration},
+            tick{tick},
+            action{action}
+        {}
+
+        void cancel() final
+        {
+            if (this->wheel)
+            {
+                this->wheel->cancel(*this);
+            }
+        }
+
+        steady_time_t expires_at() final
+        {
+            return this->expiration;
+        }
+
+    private:
+        // null once the timer has expired or been canceled
+        TimerWheel* wheel;
+        const steady_time_t expiration;
+        const tick_t tick;
+        action_t action;
+
+        // the wheel owns a scheduled timer, the Timer handed to the user only observes it
+        std::shared_ptr<WheelTimer> self;
+
+        // intrusive list of the slot this timer is in
+        WheelTimer* next = nullptr;
+        WheelTimer** prev_next = nullptr;
+        uint8_t level = 0;
+        uint8_t slot = 0;
+    };
+
+public:
+    TimerWheel(const steady_time_t& epoch, const arm_t& arm, const action_t& disarm) :
+        epoch{epoch},
+        max_tick{static_cast<tick_t>(std::chrono::duration_cast<resolution_t>(steady_time_t::max() - epoch).count())},
+        arm{arm},
+        disarm{disarm}
+    {}
+
+    ~TimerWheel()
+    {
+        for (auto& level : this->slots)
+        {
+            for (auto& head : level)
+            {
+                this->release(head);
+            }
+        }
+
+        this->release(this->overflow);
+        this->release(this->expiring);
+    }
+
+    // Uncopyable
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    std::shared_ptr<ITimer> start(const steady_time_t& expiration, const steady_time_t& now, const action_t& action)
+    {
+        if (this->num_timers == 0)
+        {
+            // nothing is scheduled relative to the old position, catch up without walking the ticks in between
+            this->current = std::max(this->current, this->to_tick_floor(now));
+        }
+
+        const auto timer = std::make_shared<WheelTimer>(this, expiration, this->to_tick_ceil(expiration), action);
+        timer->self = timer;
+
+        this->insert(*timer);
+        ++this->num_timers;
+
+        this->update_driver();
+
+        return timer;
+    }
+
+    /// run every timer that has expired at the specified time, called when the underlying timer fires
+    void expire(const steady_time_t& now)
+    {
+        this->armed = false;
+        this->is_expiring = true;
+
+        const auto now_tick = this->to_tick_floor(now);
+        bool processed = false;
+
+        while (this->num_timers > 0)
+        {
+            const auto next = this->next_event();
+
+            // a current slot that is occupied again only holds timers started by the actions of this pass
+            if (next > now_tick || (processed && next == this->current))
+            {
+                break;
+            }
+
+            this->current = next;
+            this->process_current();
+            processed = true;
+        }
+
+        if (this->num_timers == 0)
+        {
+            this->current = std::max(this->current, now_tick);
+        }
+
+        this->is_expiring = false;
+        this->update_driver();
+    }
+
+    /// @return the number of timers that are scheduled
+    size_t size() const
+    {
+        return this->num_timers;
+    }
+
+private:
+    tick_t to_tick_floor(const steady_time_t& time) const
+    {
+        if (time <= this->epoch)
+        {
+            return 0;
+        }
+
+        return static_cast<tick_t>(std::chrono::duration_cast<resolution_t>(time - this->epoch).count());
+    }
+
+    tick_t to_tick_ceil(const steady_time_t& time) const
+    {
+        const auto tick = this->to_tick_floor(time);
+
+        if (tick >= this->max_tick || this->to_time(tick) >= time)
+        {
+            return tick;
+        }
+
+        return tick + 1;
+    }
+
+    steady_time_t to_time(tick_t tick) const
+    {
+        return this->epoch + resolution_t(static_cast<resolution_t::rep>(tick));
+    }
+
+    void insert(WheelTimer& timer, bool at_front = false)
+    {
+        if (timer.tick <= this->current)
+        {
+            // already due, the slot of the current tick is processed on the next pass
+            this->link(timer, 0, static_cast<uint8_t>(this->current & slot_mask), at_front);
+            return;
+        }
+
+        // the level is the highest group of bits in which the expiration differs from the current tick,
+        // so each level only holds timers in slots after the current one and never wraps around
+        const auto diff = timer.tick ^ this->current;
+
+        uint8_t level = 0;
+        while (level < num_levels && (diff >> (bits_per_level * (level + 1))) != 0)
+        {
+            ++level;
+        }
+
+        if (level == overflow_level)
+        {
+            this->link(timer, overflow_level, 0, at_front);
+        }
+        else
+        {
+            this->link(timer, level, static_cast<uint8_t>((timer.tick >> (bits_per_level * level)) & slot_mask),
+                       at_front);
+        }
+    }
+
+    WheelTimer*& head_of(uint8_t level, uint8_t slot)
+    {
+        switch (level)
+        {
+        case (overflow_level):
+            return this->overflow;
+        case (expiring_level):
+            return this->expiring;
+        default:
+            return this->slots[level][slot];
+        }
+    }
+
+    // the next pointer of the last timer of a list, only valid while the list is not empty
+    WheelTimer**& tail_of(uint8_t level, uint8_t slot)
+    {
+        switch (level)
+        {
+        case (overflow_level):
+            return this->overflow_tail;
+        case (expiring_level):
+            return this->expiring_tail;
+        default:
+            return this->tails[level][slot];
+        }
+    }
+
+    // append a timer to a list, or prepend it to restore the order of timers that were started before the others
+    void link(WheelTimer& timer, uint8_t level, uint8_t slot, bool at_front = false)
+    {
+        auto& head = this->head_of(level, slot);
+        auto& tail = this->tail_of(level, slot);
+
+        timer.level = level;
+        timer.slot = slot;
+
+        if (!head)
+        {
+            timer.next = nullptr;
+            timer.prev_next = &head;
+            head = &timer;
+            tail = &timer.next;
+        }
+        else if (at_front)
+        {
+            timer.next = head;
+            timer.prev_next = &head;
+            head->prev_next = &timer.next;
+            head = &timer;
+        }
+        else
+        {
+            timer.next = nullptr;
+            timer.prev_next = tail;
+            *tail = &timer;
+            tail = &timer.next;
+        }
+
+        if (level < num_levels)
+        {
+            this->occupied[level] |= (uint64_t(1) << slot);
+        }
+    }
+
+    void unlink(WheelTimer& timer)
+    {
+        *timer.prev_next = timer.next;
+        if (timer.next)
+        {
+            timer.next->prev_next = timer.prev_next;
+        }
+        else
+        {
+            this->tail_of(timer.level, timer.slot) = timer.prev_next;
+        }
+
+        if (timer.level < num_levels && !this->slots[timer.level][timer.slot])
+        {
+            this->occupied[timer.level] &= ~(uint64_t(1) << timer.slot);
+        }
+
+        timer.next = nullptr;
+        timer.prev_next = nullptr;
+    }
+
+    void cancel(WheelTimer& timer)
+    {
+        this->unlink(timer);
+        timer.wheel = nullptr;
+        --this->num_timers;
+
+        // the caller holds a reference to the timer
+        timer.self.reset();
+
+        this->update_driver();
+    }
+
+    // move every timer of a higher level slot or of the overflow list to where it now belongs
+    void cascade(uint8_t level, uint8_t slot)
+    {
+        auto& head = this->head_of(level, slot);
+
+        // detach the list first, reversed, timers in the overflow list may go straight back into it
+        WheelTimer* reversed = nullptr;
+        while (head)
+        {
+            auto timer = head;
+            head = timer->next;
+            timer->next = reversed;
+            reversed = timer;
+        }
+        if (level < num_levels)
+        {
+            this->occupied[level] &= ~(uint64_t(1) << slot);
+        }
+
+        // timers due at the same tick that are already in a lower level were started after these ones,
+        // so prepending the reversed list keeps every slot in the order the timers were started
+        while (reversed)
+        {
+            const auto next = reversed->next;
+            reversed->next = nullptr;
+            reversed->prev_next = nullptr;
+            this->insert(*reversed, true);
+            reversed = next;
+        }
+    }
+
+    void process_current()
+    {
+        // a cascade never lands in the slot of the current tick at a higher level, so the lowest level goes first:
+        // the timers of each level were started before the timers due at the same tick in the levels below it
+        for (uint8_t level = 1; level < num_levels; ++level)
+        {
+            const auto shift = bits_per_level * level;
+            if ((this->current & ((tick_t(1) << shift) - 1)) == 0)
+            {
+                this->cascade(level, static_cast<uint8_t>((this->current >> shift) & slot_mask));
+            }
+        }
+
+        if ((this->current & ((tick_t(1) << overflow_shift) - 1)) == 0)
+        {
+            this->cascade(overflow_level, 0);
+        }
+
+        // timers started by an action that are already due land in the emptied slot and wait for the next pass
+        const auto slot = static_cast<uint8_t>(this->current & slot_mask);
+        while (auto timer = this->slots[0][slot])
+        {
+            this->unlink(*timer);
+            this->link(*timer, expiring_level, 0);
+        }
+
+        while (this->expiring)
+        {
+            auto timer = std::move(this->expiring->self);
+            this->unlink(*timer);
+            timer->wheel = nullptr;
+            --this->num_timers;
+
+            const auto action = std::move(timer->action);
+            action();
+        }
+    }
+
+    // @return the first tick at which a timer expires or a slot must be cascaded
+    tick_t next_event() const
+    {
+        auto next = std::numeric_limits<tick_t>::max();
+
+        if (this->overflow)
+        {
+            next = ((this->current >> overflow_shift) + 1) << overflow_shift;
+        }
+
+        for (uint32_t level = 0; level < num_levels; ++level)
+        {
+            const auto shift = bits_per_level * level;
+            const auto index = static_cast<uint32_t>((this->current >> shift) & slot_mask);
+
+            // level 0 includes the current slot, which holds timers that are already due
+            const auto first = (level == 0) ? index : index + 1;
+            if (first >= slots_per_level)
+            {
+                continue;
+            }
+
+            const auto candidates = this->occupied[level] & (~uint64_t(0) << first);
+            if (candidates == 0)
+            {
+                continue;
+            }
+
+            const auto slot = static_cast<tick_t>(lowest_bit(candidates));
+            const auto base = (this->current >> (shift + bits_per_level)) << (shift + bits_per_level);
+            next = std::min(next, base | (slot << shift));
+        }
+
+        return next;
+    }
+
+    static uint32_t lowest_bit(uint64_t value)
+    {
+        uint32_t index = 0;
+        while ((value & 1) == 0)
+        {
+            value >>= 1;
+            ++index;
+        }
+        return index;
+    }
+
+    void update_driver()
+    {
+        if (this->is_expiring)
+        {
+            return;
+        }
+
+        if (this->num_timers == 0)
+        {
+            if (this->armed)
+            {
+                this->armed = false;
+                this->disarm();
+            }
+            return;
+        }
+
+        const auto next = this->next_event();
+        if (!this->armed || next < this->armed_tick)
+        {
+            this->armed = true;
+            this->armed_tick = next;
+            this->arm(this->to_time(next));
+        }
+    }
+
+    // drop the timers of a list without running them
+    static void release(WheelTimer*& head)
+    {
+        while (head)
+        {
+            auto timer = head;
+            head = timer->next;
+            timer->next = nullptr;
+            timer->prev_next = nullptr;
+            timer->wheel = nullptr;
+            timer->self.reset();
+        }
+    }
+
+    const steady_time_t epoch;
+    const tick_t max_tick;
+    const arm_t arm;
+    const action_t disarm;
+
+    tick_t current = 0;
+    size_t num_timers = 0;
+
+    bool armed = false;
+    tick_t armed_tick = 0;
+    bool is_expiring = false;
+
+    WheelTimer* slots[num_levels][slots_per_level] = {};
+    WheelTimer** tails[num_levels][slots_per_level] = {};
+    uint64_t occupied[num_levels] = {};
+    WheelTimer* overflow = nullptr;
+    WheelTimer** overflow_tail = nullptr;
+    WheelTimer* expiring = nullptr;
+    WheelTimer** expiring_tail = nullptr;
+};
+
+}
+
+#endif
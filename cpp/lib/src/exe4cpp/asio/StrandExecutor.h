@@ -28,6 +28,7 @@
 #include "exe4cpp/asio/AsioExecutor.h"
 #include "exe4cpp/asio/AsioSystemTimer.h"
 #include "exe4cpp/asio/AsioTimer.h"
+#include "exe4cpp/TimerWheel.h"
 
 #include "AsioHeader.h"
 
@@ -50,7 +51,13 @@ public:
 
     StrandExecutor(const std::shared_ptr<ASIO::io_context>& io_context) :
         AsioExecutor{io_context},
-        strand{*io_context}
+        strand{*io_context},
+        driver{*io_context},
+        wheel{
+            std::chrono::steady_clock::now(),
+            [this](const steady_time_t& expiration) { this->arm_driver(expiration); },
+            [this]() { this->disarm_driver(); }
+        }
     {}
 
     static std::shared_ptr<StrandExecutor> create(const std::shared_ptr<ASIO::io_context>& io_context)
@@ -72,6 +79,12 @@ public:
 
     Timer start(const steady_time_t& expiration, const action_t& action) final
     {
+        // timers started on the strand share the wheel and its single asio timer
+        if (strand.running_in_this_thread())
+        {
+            return Timer(this->wheel.start(expiration, this->get_time(), action));
+        }
+
         const auto timer = AsioTimer::create(this->io_context);
 
         timer->impl.expires_at(expiration);
@@ -137,7 +150,37 @@ public:
     }
 
 private:
+    void arm_driver(const steady_time_t& expiration)
+    {
+        driver.expires_at(expiration);
+
+        // a wait replaced by a later arm or disarm may still complete without an error
+        const auto generation = ++this->driver_generation;
+
+        auto callback = [generation, self = shared_from_this()](const ASIO_ERROR & ec)
+        {
+            if (!ec && generation == self->driver_generation)
+            {
+                self->wheel.expire(self->get_time());
+            }
+        };
+
+        driver.async_wait(strand.wrap(callback));
+    }
+
+    void disarm_driver()
+    {
+        ++this->driver_generation;
+
+        ASIO_ERROR ec;
+        driver.cancel(ec);
+    }
+
     ASIO::io_context::strand strand;
+
+    ASIO::basic_waitable_timer<std::chrono::steady_clock> driver;
+    uint64_t driver_generation = 0;
+    TimerWheel wheel;
 };
 
 }
@@ -19,8 +19,12 @@
  */
 #include "CRC.h"
 
+#include "link/LinkLayerConstants.h"
+
 #include <ser4cpp/serialization/LittleEndian.h>
 
+#include <cstring>
+
 namespace opendnp3
 {
 
@@ -45,7 +49,89 @@ uint16_t CRC::crcTable[256]
        0x9600, 0xA05E, 0x6E26, 0x5878, 0x029A, 0x34C4, 0xB75E, 0x8100, 0xDBE2, 0xEDBC, 0x91AF, 0xA7F1, 0xFD13, 0xCB4D,
        0x48D7, 0x7E89, 0x246B, 0x1235};
 
+namespace
+{
+    // tables[k][i] is the CRC contribution of byte i followed by k zero bytes
+    class SlicingTables
+    {
+    public:
+        explicit SlicingTables(const uint16_t* byteTable)
+        {
+            std::memcpy(tables[0], byteTable, sizeof(tables[0]));
+
+            for (size_t k = 1; k < 8; ++k)
+            {
+                for (size_t i = 0; i < 256; ++i)
+                {
+                    const uint16_t previous = tables[k - 1][i];
+                    tables[k][i] = static_cast<uint16_t>(tables[0][previous & 0xFF] ^ (previous >> 8));
+                }
+            }
+        }
+
+        inline uint16_t Update8(uint16_t crc, const uint8_t* input) const
+        {
+            const uint16_t low = static_cast<uint16_t>(crc ^ (input[0] | (input[1] << 8)));
+
+            return static_cast<uint16_t>(tables[7][low & 0xFF] ^ tables[6][low >> 8] ^ tables[5][input[2]]
+                                         ^ tables[4][input[3]] ^ tables[3][input[4]] ^ tables[2][input[5]]
+                                         ^ tables[1][input[6]] ^ tables[0][input[7]]);
+        }
+
+        inline uint16_t Update1(uint16_t crc, uint8_t input) const
+        {
+            return static_cast<uint16_t>(tables[0][(crc ^ input) & 0xFF] ^ (crc >> 8));
+        }
+
+    private:
+        uint16_t tables[8][256];
+    };
+
+    // built on first use from the constant byte table, so a CRC can be computed during static initialization
+    const SlicingTables& GetSlicingTables(const uint16_t* byteTable)
+    {
+        static const SlicingTables tables(byteTable);
+        return tables;
+    }
+
+    inline bool MatchesCrc(const uint8_t* input, uint16_t crc)
+    {
+    // This definition is automatically set when compiling for OSS-Fuzz.
+    // See https://llvm.org/docs/LibFuzzer.html#fuzzer-friendly-build-mode
+#ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
+        (void)input;
+        (void)crc;
+        return true;
+#else
+        return (input[0] == static_cast<uint8_t>(crc & 0xFF)) && (input[1] == static_cast<uint8_t>(crc >> 8));
+#endif
+    }
+
+} // namespace
+
 uint16_t CRC::CalcCrc(const uint8_t* input, size_t length)
+{
+    const auto& slicing = GetSlicingTables(crcTable);
+    uint16_t crc = 0;
+
+    while (length >= 8)
+    {
+        crc = slicing.Update8(crc, input);
+        input += 8;
+        length -= 8;
+    }
+
+    while (length > 0)
+    {
+        crc = slicing.Update1(crc, *input);
+        ++input;
+        --length;
+    }
+
+    return static_cast<uint16_t>(~crc);
+}
+
+uint16_t CRC::CalcCrcBytewise(const uint8_t* input, size_t length)
 {
     uint16_t CRC = 0;
 
@@ -58,6 +144,12 @@ uint16_t CRC::CalcCrc(const uint8_t* input, size_t length)
     return ~CRC;
 }
 
+uint16_t CRC::CalcFullBlockCrc(const uint8_t* input)
+{
+    const auto& slicing = GetSlicingTables(crcTable);
+    return static_cast<uint16_t>(~slicing.Update8(slicing.Update8(0, input), input + 8));
+}
+
 uint16_t CRC::CalcCrc(const ser4cpp::rseq_t& view)
 {
     return CalcCrc(view, view.length());
@@ -85,4 +177,48 @@ bool CRC::IsCorrectCRC(const uint8_t* input, size_t length)
 #endif
 }
 
+bool CRC::AreBlockCRCsCorrect(const uint8_t* body, size_t length)
+{
+    // blocks are independent, so the table lookups of consecutive blocks can overlap
+    while (length >= LPDU_DATA_BLOCK_SIZE)
+    {
+        if (!MatchesCrc(body + LPDU_DATA_BLOCK_SIZE, CalcFullBlockCrc(body)))
+        {
+            return false;
+        }
+
+        body += LPDU_DATA_PLUS_CRC_SIZE;
+        length -= LPDU_DATA_BLOCK_SIZE;
+    }
+
+    return (length == 0) || MatchesCrc(body + length, CalcCrc(body, length));
+}
+
+bool CRC::StripBlockCRCs(const uint8_t* body, uint8_t* dest, size_t length)
+{
+    while (length >= LPDU_DATA_BLOCK_SIZE)
+    {
+        // the block is still in cache from calculating its CRC when it is copied
+        const auto crc = CalcFullBlockCrc(body);
+        memcpy(dest, body, LPDU_DATA_BLOCK_SIZE);
+
+        if (!MatchesCrc(body + LPDU_DATA_BLOCK_SIZE, crc))
+        {
+            return false;
+        }
+
+        body += LPDU_DATA_PLUS_CRC_SIZE;
+        dest += LPDU_DATA_BLOCK_SIZE;
+        length -= LPDU_DATA_BLOCK_SIZE;
+    }
+
+    if (length == 0)
+    {
+        return true;
+    }
+
+    memcpy(dest, body, length);
+    return MatchesCrc(body + length, CalcCrc(body, length));
+}
+
 } // namespace opendnp3
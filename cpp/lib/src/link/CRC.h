@@ -27,18 +27,47 @@
 namespace opendnp3
 {
 
+/**
+ * CRC-16/DNP calculations
+ *
+ * Buffers are processed 8 bytes per step with slicing-by-8 tables derived from the single byte table. The
+ * byte-at-a-time version is kept as the reference implementation.
+ */
 class CRC
 {
 public:
     static uint16_t CalcCrc(const uint8_t* input, size_t length);
 
+    static uint16_t CalcCrcBytewise(const uint8_t* input, size_t length);
+
     static uint16_t CalcCrc(const ser4cpp::rseq_t& view);
 
     static void AddCrc(uint8_t* input, size_t length);
 
     static bool IsCorrectCRC(const uint8_t* input, size_t length);
 
+    /**
+     * Validate every block CRC of a link frame body in a single pass
+     *
+     * @param body the frame body, i.e. the user data interleaved with a CRC after every 16 byte block
+     * @param length the length of the user data, excluding the CRCs
+     * @return true if all of the block CRCs are correct
+     */
+    static bool AreBlockCRCsCorrect(const uint8_t* body, size_t length);
+
+    /**
+     * Copy the user data out of a link frame body while validating its block CRCs in the same pass
+     *
+     * @param body the frame body, i.e. the user data interleaved with a CRC after every 16 byte block
+     * @param dest destination for the user data, must not overlap the body
+     * @param length the length of the user data, excluding the CRCs
+     * @return true if all of the block CRCs are correct. The content of dest is unspecified otherwise.
+     */
+    static bool StripBlockCRCs(const uint8_t* body, uint8_t* dest, size_t length);
+
 private:
+    static uint16_t CalcFullBlockCrc(const uint8_t* input);
+
     static uint16_t crcTable[256]; // Precomputed CRC lookup table
 };
 
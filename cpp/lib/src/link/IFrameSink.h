@@ -36,6 +36,17 @@ public:
     virtual ~IFrameSink() {}
 
     virtual bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) = 0;
+
+    /**
+     * Called before the user data of a frame is de-CRC'd so that the sink can provide the final destination of the
+     * data, e.g. the transport reassembly buffer of the session the frame is routed to.
+     *
+     * @return a buffer of at least length bytes, or an empty buffer if the parser should use its own buffer
+     */
+    virtual ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& /*header*/, size_t /*length*/)
+    {
+        return ser4cpp::wseq_t::empty();
+    }
 };
 
 } // namespace opendnp3
@@ -24,6 +24,8 @@
 
 #include <ser4cpp/container/SequenceTypes.h>
 
+#include <cstdint>
+
 namespace opendnp3
 {
 
@@ -37,8 +39,12 @@ public:
 
     virtual bool HasValue() const = 0;
 
-    // Read the current segment with a specified max size
-    virtual ser4cpp::rseq_t GetSegment() = 0;
+    // Read the transport header of the current segment
+    virtual uint8_t GetHeader() = 0;
+
+    // Read the data of the current segment that follows the transport header. The data is read in place
+    // from the fragment so that the link layer copies it straight into its frames.
+    virtual ser4cpp::rseq_t GetPayload() = 0;
 
     // move to the next segment, true if more segments available
     virtual bool Advance() = 0;
@@ -151,13 +151,24 @@ bool LinkContext::OnTxReady()
     return true;
 }
 
-ser4cpp::rseq_t LinkContext::FormatPrimaryBufferWithUnconfirmed(const Addresses& addr, const ser4cpp::rseq_t& tpdu)
+ser4cpp::rseq_t LinkContext::FormatPrimaryBufferWithUnconfirmed(ITransportSegment& segments)
 {
+    // frames are formatted back to back so that the channel can write them all at once. The segments are read
+    // in place from the fragment, so this is the only copy of the data between the application layer and the channel
     auto buffer = this->priTxBuffer.as_wseq();
-    auto output
-        = LinkFrame::FormatUnconfirmedUserData(buffer, config.IsMaster, addr.destination, addr.source, tpdu, &logger);
-    FORMAT_HEX_BLOCK(logger, flags::LINK_TX_HEX, output, 10, 18);
-    return output;
+    size_t length = 0;
+
+    do
+    {
+        const auto& addr = segments.GetAddresses();
+        auto output = LinkFrame::FormatUnconfirmedUserData(buffer, config.IsMaster, addr.destination, addr.source,
+                                                           segments.GetHeader(), segments.GetPayload(), &logger);
+        FORMAT_HEX_BLOCK(logger, flags::LINK_TX_HEX, output, 10, 18);
+        length += output.length();
+        this->hasMoreSegments = segments.Advance();
+    } while (this->hasMoreSegments && buffer.length() >= LPDU_MAX_FRAME_SIZE);
+
+    return this->priTxBuffer.as_seq(length);
 }
 
 void LinkContext::QueueTransmit(const ser4cpp::rseq_t& buffer, bool primary)
@@ -88,7 +88,8 @@ public:
     bool SetTxSegment(ITransportSegment& segments);
 
     // --- helpers for formatting user data messages ---
-    ser4cpp::rseq_t FormatPrimaryBufferWithUnconfirmed(const Addresses& addr, const ser4cpp::rseq_t& tpdu);
+    // formats as many of the remaining segments as fit in the primary buffer, see hasMoreSegments
+    ser4cpp::rseq_t FormatPrimaryBufferWithUnconfirmed(ITransportSegment& segments);
 
     // --- Helpers for queueing frames ---
     void QueueAck(uint16_t destination);
@@ -113,7 +114,7 @@ public:
     bool TryPendingTx(ser4cpp::Settable<ser4cpp::rseq_t>& pending, bool primary);
 
     // buffers used for primary and secondary requests
-    ser4cpp::StaticBuffer<LPDU_MAX_FRAME_SIZE> priTxBuffer;
+    ser4cpp::StaticBuffer<LPDU_MAX_FRAME_SIZE * LPDU_MAX_FRAMES_PER_TX> priTxBuffer;
     ser4cpp::StaticBuffer<LPDU_HEADER_SIZE> secTxBuffer;
 
     ser4cpp::Settable<ser4cpp::rseq_t> pendingPriTx;
@@ -122,6 +123,7 @@ public:
     Logger logger;
     const LinkLayerConfig config;
     ITransportSegment* pSegments;
+    bool hasMoreSegments = false;
     LinkTransmitMode txMode;
 
     const std::shared_ptr<exe4cpp::IExecutor> executor;
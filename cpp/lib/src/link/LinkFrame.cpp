@@ -50,22 +50,12 @@ void LinkFrame::ReadUserData(const uint8_t* pSrc, uint8_t* pDest, size_t len)
 
 bool LinkFrame::ValidateBodyCRC(const uint8_t* pBody, size_t length)
 {
-    while (length > 0)
-    {
-        size_t max = LPDU_DATA_BLOCK_SIZE;
-        size_t num = (length <= max) ? length : max;
+    return CRC::AreBlockCRCsCorrect(pBody, length);
+}
 
-        if (CRC::IsCorrectCRC(pBody, num))
-        {
-            pBody += (num + 2);
-            length -= num;
-        }
-        else
-        {
-            return false;
-        }
-    }
-    return true;
+bool LinkFrame::ValidateAndReadUserData(const uint8_t* pSrc, uint8_t* pDest, size_t length)
+{
+    return CRC::StripBlockCRCs(pSrc, pDest, length);
 }
 
 size_t LinkFrame::CalcFrameSize(size_t dataLength)
@@ -73,6 +63,18 @@ size_t LinkFrame::CalcFrameSize(size_t dataLength)
     return LPDU_HEADER_SIZE + CalcUserDataSize(dataLength);
 }
 
+size_t LinkFrame::CountFrames(const ser4cpp::rseq_t& frames)
+{
+    size_t count = 0;
+    auto remainder = frames;
+    while (remainder.length() >= LPDU_HEADER_SIZE && remainder[LI_LENGTH] >= LPDU_MIN_LENGTH)
+    {
+        remainder.advance(CalcFrameSize(remainder[LI_LENGTH] - LPDU_MIN_LENGTH));
+        ++count;
+    }
+    return count;
+}
+
 size_t LinkFrame::CalcUserDataSize(size_t dataLength)
 {
     if (dataLength > 0)
@@ -181,6 +183,29 @@ ser4cpp::rseq_t LinkFrame::FormatUnconfirmedUserData(
     return ret;
 }
 
+ser4cpp::rseq_t LinkFrame::FormatUnconfirmedUserData(ser4cpp::wseq_t& buffer,
+                                                     bool aIsMaster,
+                                                     uint16_t aDest,
+                                                     uint16_t aSrc,
+                                                     uint8_t transportHeader,
+                                                     ser4cpp::rseq_t payload,
+                                                     Logger* pLogger)
+{
+    if (payload.length() >= LPDU_MAX_USER_DATA_SIZE)
+    {
+        return ser4cpp::rseq_t::empty();
+    }
+
+    const auto length = payload.length() + 1;
+    auto userDataSize = CalcUserDataSize(length);
+    auto ret = buffer.readonly().take(userDataSize + LPDU_HEADER_SIZE);
+    FormatHeader(buffer, static_cast<uint8_t>(length), aIsMaster, false, false,
+                 LinkFunction::PRI_UNCONFIRMED_USER_DATA, aDest, aSrc, pLogger);
+    WriteUserData(transportHeader, payload, buffer, payload.length());
+    buffer.advance(userDataSize);
+    return ret;
+}
+
 ser4cpp::rseq_t LinkFrame::FormatHeader(ser4cpp::wseq_t& buffer,
                                         uint8_t aDataLength,
                                         bool aIsMaster,
@@ -221,4 +246,14 @@ void LinkFrame::WriteUserData(const uint8_t* pSrc, uint8_t* pDest, size_t length
     }
 }
 
+void LinkFrame::WriteUserData(uint8_t first, const uint8_t* pSrc, uint8_t* pDest, size_t length)
+{
+    // the first block holds the leading byte, the rest of the data lines up with the blocks that follow
+    size_t num = length > (LPDU_DATA_BLOCK_SIZE - 1) ? (LPDU_DATA_BLOCK_SIZE - 1) : length;
+    pDest[0] = first;
+    memcpy(pDest + 1, pSrc, num);
+    CRC::AddCrc(pDest, num + 1);
+    WriteUserData(pSrc + num, pDest + num + 3, length - num);
+}
+
 } // namespace opendnp3
@@ -71,6 +71,16 @@ public:
                                                      ser4cpp::rseq_t user_data,
                                                      Logger* pLogger);
 
+    /** Formats an unconfirmed user data frame from a transport header and the data that follows it, which are
+        written straight into the frame so that the segment never has to be assembled in a buffer of its own */
+    static ser4cpp::rseq_t FormatUnconfirmedUserData(ser4cpp::wseq_t& buffer,
+                                                     bool aIsMaster,
+                                                     uint16_t aDest,
+                                                     uint16_t aSrc,
+                                                     uint8_t transportHeader,
+                                                     ser4cpp::rseq_t payload,
+                                                     Logger* pLogger);
+
     ////////////////////////////////////////////////
     //	Reusable static formatting functions to any buffer
     ////////////////////////////////////////////////
@@ -88,9 +98,19 @@ public:
     @return True if the body CRC is correct */
     static bool ValidateBodyCRC(const uint8_t* apBody, size_t aLength);
 
+    /** Validates FT3 user data integrity while reading it to dest, removing the CRCs in the same pass
+    @param apSrc Beginning of the FT3 user data
+    @param apDest Destination buffer to which the data is extracted, must not overlap the source
+    @param aLength Number of user bytes to read, not user + crc.
+    @return True if the body CRC is correct */
+    static bool ValidateAndReadUserData(const uint8_t* apSrc, uint8_t* apDest, size_t aLength);
+
     // @return Total frame size based on user data length
     static size_t CalcFrameSize(size_t dataLength);
 
+    // @return Number of frames in a buffer of back to back frames
+    static size_t CountFrames(const ser4cpp::rseq_t& frames);
+
 private:
     static size_t CalcUserDataSize(size_t dataLength);
 
@@ -101,6 +121,14 @@ private:
     */
     static void WriteUserData(const uint8_t* pSrc, uint8_t* pDest, size_t length);
 
+    /** Writes a leading byte followed by data from src to dest interlacing 2 byte CRC checks every 16 data bytes
+        @param first The first user data byte
+        @param apSrc Source buffer with the remainder of the user data
+        @param apDest Destination buffer where the data + CRC is written
+        @param length Number of user data bytes in the source buffer
+    */
+    static void WriteUserData(uint8_t first, const uint8_t* pSrc, uint8_t* pDest, size_t length);
+
     /** Write 10 header bytes to to buffer including 0x0564, all fields, and CRC */
     static ser4cpp::rseq_t FormatHeader(ser4cpp::wseq_t& buffer,
                                         uint8_t aDataLength,
@@ -34,6 +34,12 @@ const uint8_t LPDU_DATA_PLUS_CRC_SIZE = 18;
 const uint8_t LPDU_MAX_USER_DATA_SIZE = 250;
 const uint16_t LPDU_MAX_FRAME_SIZE = 292; // 10(header) + 250 (user data) + 32 (block CRC's) = 292 frame bytes
 
+// default size of the buffer that channel reads are parsed from, large enough to take a burst of frames in one read
+const uint32_t LINK_DEFAULT_RX_BUFFER_SIZE = 65536;
+
+// maximum number of unconfirmed user data frames that are pre-formatted and handed to the channel as one write
+const uint8_t LPDU_MAX_FRAMES_PER_TX = 16;
+
 // Broadcast addresses
 enum LinkBroadcastAddress : uint16_t
 {
@@ -28,8 +28,12 @@
 namespace opendnp3
 {
 
-LinkLayerParser::LinkLayerParser(const Logger& logger)
-    : logger(logger), state(State::FindSync), frameSize(0), buffer(rxBuffer, LPDU_MAX_FRAME_SIZE)
+LinkLayerParser::LinkLayerParser(const Logger& logger, size_t bufferSize)
+    : logger(logger),
+      state(State::FindSync),
+      frameSize(0),
+      rxBuffer(bufferSize < LPDU_MAX_FRAME_SIZE ? LPDU_MAX_FRAME_SIZE : bufferSize),
+      buffer(rxBuffer.as_wslice(), rxBuffer.length())
 {
 }
 
@@ -48,29 +52,38 @@ ser4cpp::wseq_t LinkLayerParser::WriteBuff() const
 void LinkLayerParser::OnRead(size_t numBytes, IFrameSink& sink)
 {
     buffer.AdvanceWrite(numBytes);
+    ++statistics.numReads;
 
-    while (ParseUntilComplete() == State::Complete)
+    // drain every complete frame before the next read is started
+    size_t numFrames = 0;
+    while (ParseUntilComplete(sink) == State::Complete)
     {
+        ++numFrames;
         ++statistics.numLinkFrameRx;
         this->PushFrame(sink);
         state = State::FindSync;
     }
 
+    if (numFrames > statistics.maxFramesPerRead)
+    {
+        statistics.maxFramesPerRead = numFrames;
+    }
+
     buffer.Shift();
 }
 
-LinkLayerParser::State LinkLayerParser::ParseUntilComplete()
+LinkLayerParser::State LinkLayerParser::ParseUntilComplete(IFrameSink& sink)
 {
     auto lastState = this->state;
     // continue as long as we're making progress, i.e. a state change
-    while ((this->state = ParseOneStep()) != lastState)
+    while ((this->state = ParseOneStep(sink)) != lastState)
     {
         lastState = state;
     }
     return state;
 }
 
-LinkLayerParser::State LinkLayerParser::ParseOneStep()
+LinkLayerParser::State LinkLayerParser::ParseOneStep(IFrameSink& sink)
 {
     switch (state)
     {
@@ -79,7 +92,7 @@ LinkLayerParser::State LinkLayerParser::ParseOneStep()
     case (State::ReadHeader):
         return ParseHeader();
     case (State::ReadBody):
-        return ParseBody();
+        return ParseBody(sink);
     default:
         return state;
     }
@@ -120,16 +133,15 @@ LinkLayerParser::State LinkLayerParser::ParseHeader()
     }
 }
 
-LinkLayerParser::State LinkLayerParser::ParseBody()
+LinkLayerParser::State LinkLayerParser::ParseBody(IFrameSink& sink)
 {
     if (buffer.NumBytesRead() < this->frameSize)
     {
         return State::ReadBody;
     }
 
-    if (this->ValidateBody())
+    if (this->ValidateBody(sink))
     {
-        this->TransferUserData();
         return State::Complete;
     }
 
@@ -139,19 +151,15 @@ LinkLayerParser::State LinkLayerParser::ParseBody()
 
 void LinkLayerParser::PushFrame(IFrameSink& sink)
 {
-    LinkHeaderFields fields(header.GetFuncEnum(), header.IsFromMaster(), header.IsFcbSet(), header.IsFcvDfcSet(),
-                            Addresses(header.GetSrc(), header.GetDest()));
-
-    sink.OnFrame(fields, userData);
+    sink.OnFrame(this->GetHeaderFields(), userData);
 
     buffer.AdvanceRead(frameSize);
 }
 
-void LinkLayerParser::TransferUserData()
+LinkHeaderFields LinkLayerParser::GetHeaderFields() const
 {
-    uint32_t len = header.GetLength() - LPDU_MIN_LENGTH;
-    LinkFrame::ReadUserData(buffer.ReadBuffer() + LPDU_HEADER_SIZE, rxBuffer, len);
-    userData = ser4cpp::rseq_t(rxBuffer, len);
+    return LinkHeaderFields(header.GetFuncEnum(), header.IsFromMaster(), header.IsFcbSet(), header.IsFcvDfcSet(),
+                            Addresses(header.GetSrc(), header.GetDest()));
 }
 
 bool LinkLayerParser::ReadHeader()
@@ -169,23 +177,46 @@ bool LinkLayerParser::ReadHeader()
     }
 }
 
-bool LinkLayerParser::ValidateBody()
+bool LinkLayerParser::ValidateBody(IFrameSink& sink)
 {
-    uint32_t len = header.GetLength() - LPDU_MIN_LENGTH;
-    if (LinkFrame::ValidateBodyCRC(buffer.ReadBuffer() + LPDU_HEADER_SIZE, len))
+    const uint32_t len = header.GetLength() - LPDU_MIN_LENGTH;
+    const uint8_t* body = buffer.ReadBuffer() + LPDU_HEADER_SIZE;
+
+    // if the sink has a destination for the user data, e.g. the reassembly buffer of the session the frame is routed
+    // to, the CRCs are validated and stripped straight into it in one pass
+    const auto destination
+        = (len > 0) ? sink.GetUserDataBuffer(this->GetHeaderFields(), len) : ser4cpp::wseq_t::empty();
+    const bool direct = (len > 0) && (destination.length() >= len);
+
+    const bool valid = direct ? LinkFrame::ValidateAndReadUserData(body, destination, len)
+                              : LinkFrame::ValidateBodyCRC(body, len);
+
+    if (!valid)
     {
-        FORMAT_LOG_BLOCK(logger, flags::LINK_RX, "Function: %s Dest: %u Source: %u Length: %u",
-                         LinkFunctionSpec::to_human_string(header.GetFuncEnum()), header.GetDest(), header.GetSrc(),
-                         header.GetLength());
+        ++this->statistics.numBodyCrcError;
+        SIMPLE_LOG_BLOCK(logger, flags::ERR, "CRC failure in body");
+        return false;
+    }
 
-        FORMAT_HEX_BLOCK(logger, flags::LINK_RX_HEX, buffer.ReadBuffer().take(frameSize), 10, 18);
+    FORMAT_LOG_BLOCK(logger, flags::LINK_RX, "Function: %s Dest: %u Source: %u Length: %u",
+                     LinkFunctionSpec::to_human_string(header.GetFuncEnum()), header.GetDest(), header.GetSrc(),
+                     header.GetLength());
 
-        return true;
+    FORMAT_HEX_BLOCK(logger, flags::LINK_RX_HEX, buffer.ReadBuffer().take(frameSize), 10, 18);
+
+    if (direct)
+    {
+        userData = ser4cpp::rseq_t(destination, len);
+    }
+    else
+    {
+        // de-CRC into the front of our own buffer, which may overwrite the frame
+        const auto dest = rxBuffer.as_wslice();
+        LinkFrame::ReadUserData(body, dest, len);
+        userData = ser4cpp::rseq_t(dest, len);
     }
 
-    ++this->statistics.numBodyCrcError;
-    SIMPLE_LOG_BLOCK(logger, flags::ERR, "CRC failure in body");
-    return false;
+    return true;
 }
 
 bool LinkLayerParser::ValidateHeaderParameters()
@@ -28,6 +28,7 @@
 #include "opendnp3/link/LinkStatistics.h"
 #include "opendnp3/logging/Logger.h"
 
+#include <ser4cpp/container/Buffer.h>
 #include <ser4cpp/container/SequenceTypes.h>
 
 namespace opendnp3
@@ -46,11 +47,12 @@ class LinkLayerParser
 
 public:
     /// @param logger_ Logger that the receiver is to use.
-    /// @param pSink_ Completely parsed frames are sent to this interface
-    LinkLayerParser(const Logger& logger);
+    /// @param bufferSize Size of the receive buffer, i.e. the most bytes a single read can provide.
+    ///                   Values smaller than a maximum size frame are rounded up.
+    LinkLayerParser(const Logger& logger, size_t bufferSize = LINK_DEFAULT_RX_BUFFER_SIZE);
 
     /// Called when valid data has been written to the current buffer write position
-    /// Parses the new data and calls the specified frame sink
+    /// Parses every complete frame in the new data and calls the specified frame sink
     /// @param numBytes Number of bytes written
     void OnRead(size_t numBytes, IFrameSink& sink);
 
@@ -66,22 +68,22 @@ public:
     }
 
 private:
-    State ParseUntilComplete();
-    State ParseOneStep();
+    State ParseUntilComplete(IFrameSink& sink);
+    State ParseOneStep(IFrameSink& sink);
     State ParseSync();
     State ParseHeader();
-    State ParseBody();
+    State ParseBody(IFrameSink& sink);
 
     void PushFrame(IFrameSink& sink);
 
+    LinkHeaderFields GetHeaderFields() const;
+
     bool ReadHeader();
-    bool ValidateBody();
+    bool ValidateBody(IFrameSink& sink);
     bool ValidateHeaderParameters();
     bool ValidateFunctionCode();
     void FailFrame();
 
-    void TransferUserData();
-
     Logger logger;
     LinkStatistics::Parser statistics;
 
@@ -92,7 +94,7 @@ private:
     ser4cpp::rseq_t userData;
 
     // buffer where received data is written
-    uint8_t rxBuffer[LPDU_MAX_FRAME_SIZE];
+    ser4cpp::Buffer rxBuffer;
 
     // facade over the rxBuffer that provides ability to "shift" as data is read
     ShiftableBuffer buffer;
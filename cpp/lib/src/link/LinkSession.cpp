@@ -141,6 +141,11 @@ bool LinkSession::OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t&
     return true;
 }
 
+ser4cpp::wseq_t LinkSession::GetUserDataBuffer(const LinkHeaderFields& /*header*/, size_t length)
+{
+    return this->stack ? this->stack->GetUserDataBuffer(length) : ser4cpp::wseq_t::empty();
+}
+
 std::shared_ptr<IMasterSession> LinkSession::AcceptSession(const std::string& loggerid,
                                                            std::shared_ptr<ISOEHandler> SOEHandler,
                                                            std::shared_ptr<IMasterApplication> application,
@@ -83,6 +83,8 @@ private:
     // IFrameSink
     bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) final;
 
+    ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) final;
+
     // ISessionAcceptor
     std::shared_ptr<IMasterSession> AcceptSession(const std::string& loggerid,
                                                   std::shared_ptr<ISOEHandler> SOEHandler,
@@ -89,8 +89,7 @@ PLLS_Idle PLLS_Idle::instance;
 
 PriStateBase& PLLS_Idle::TrySendUnconfirmed(LinkContext& ctx, ITransportSegment& segments)
 {
-    auto first = segments.GetSegment();
-    auto output = ctx.FormatPrimaryBufferWithUnconfirmed(segments.GetAddresses(), first);
+    auto output = ctx.FormatPrimaryBufferWithUnconfirmed(segments);
     ctx.QueueTransmit(output, true);
     return PLLS_SendUnconfirmedTransmitWait::Instance();
 }
@@ -112,10 +111,9 @@ PLLS_SendUnconfirmedTransmitWait PLLS_SendUnconfirmedTransmitWait::instance;
 
 PriStateBase& PLLS_SendUnconfirmedTransmitWait::OnTxReady(LinkContext& ctx)
 {
-    if (ctx.pSegments->Advance())
+    if (ctx.hasMoreSegments)
     {
-        auto output
-            = ctx.FormatPrimaryBufferWithUnconfirmed(ctx.pSegments->GetAddresses(), ctx.pSegments->GetSegment());
+        auto output = ctx.FormatPrimaryBufferWithUnconfirmed(*ctx.pSegments);
         ctx.QueueTransmit(output, true);
         return *this;
     }
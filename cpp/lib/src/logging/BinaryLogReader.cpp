@@ -0,0 +1,76 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "opendnp3/logging/BinaryLogReader.h"
+
+#include "logging/LogRecordFormat.h"
+
+#include <ser4cpp/serialization/LittleEndian.h>
+
+#include <cstring>
+
+namespace opendnp3
+{
+
+namespace
+{
+    bool ReadString(std::istream& input, uint16_t length, std::string& value)
+    {
+        value.resize(length);
+        return length == 0 || static_cast<bool>(input.read(&value[0], length));
+    }
+} // namespace
+
+void LogRecord::Print(std::ostream& output, bool printLocation) const
+{
+    LogRecordFormat::Print(output, this->timestamp, this->level, this->id.c_str(), this->location.c_str(),
+                           this->message.c_str(), printLocation);
+}
+
+BinaryLogReader::BinaryLogReader(std::istream& input) : input(input)
+{
+    uint8_t header[sizeof(LogRecordFormat::header)];
+    if (this->input.read(reinterpret_cast<char*>(header), sizeof(header)))
+    {
+        this->valid = memcmp(header, LogRecordFormat::header, sizeof(header)) == 0;
+    }
+}
+
+bool BinaryLogReader::Read(LogRecord& record)
+{
+    if (!this->valid)
+        return false;
+
+    uint8_t fixed[LogRecordFormat::fixed_record_size];
+    if (!this->input.read(reinterpret_cast<char*>(fixed), sizeof(fixed)))
+        return false;
+
+    uint16_t idLength = 0;
+    uint16_t locationLength = 0;
+    uint16_t messageLength = 0;
+
+    ser4cpp::rseq_t header(fixed, sizeof(fixed));
+    ser4cpp::LittleEndian::read(header, record.timestamp, record.module.value, record.level.value, idLength,
+                                locationLength, messageLength);
+
+    return ReadString(this->input, idLength, record.id) && ReadString(this->input, locationLength, record.location)
+        && ReadString(this->input, messageLength, record.message);
+}
+
+} // namespace opendnp3
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "logging/LogRecordFormat.h"
+
+#include <ser4cpp/serialization/LittleEndian.h>
+
+#include <cstring>
+
+namespace opendnp3
+{
+
+const uint8_t LogRecordFormat::header[8] = {'D', 'N', 'P', '3', 'L', 'O', 'G', 1};
+
+void LogRecordFormat::Print(std::ostream& output,
+                            int64_t timestamp,
+                            LogLevel level,
+                            const char* id,
+                            const char* location,
+                            const char* message,
+                            bool printLocation)
+{
+    output << "ms(" << timestamp << ") " << LogFlagToString(level);
+    output << " " << id;
+    if (printLocation)
+    {
+        output << " - " << location;
+    }
+    output << " - " << message << '\n';
+}
+
+size_t LogRecordFormat::Write(uint8_t* dest,
+                              int64_t timestamp,
+                              ModuleId module,
+                              LogLevel level,
+                              const char* id,
+                              uint16_t idLength,
+                              const char* location,
+                              uint16_t locationLength,
+                              const char* message,
+                              uint16_t messageLength)
+{
+    ser4cpp::wseq_t fixed(dest, fixed_record_size);
+    ser4cpp::LittleEndian::write(fixed, timestamp, module.value, level.value, idLength, locationLength, messageLength);
+
+    auto pos = dest + fixed_record_size;
+    memcpy(pos, id, idLength);
+    pos += idLength;
+    memcpy(pos, location, locationLength);
+    pos += locationLength;
+    memcpy(pos, message, messageLength);
+
+    return fixed_record_size + idLength + locationLength + messageLength;
+}
+
+} // namespace opendnp3
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_LOGRECORDFORMAT_H
+#define OPENDNP3_LOGRECORDFORMAT_H
+
+#include "opendnp3/logging/LogLevels.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace opendnp3
+{
+
+/**
+ * Text and binary encodings of log records
+ *
+ * A binary log is the 8 byte header "DNP3LOG" + version, followed by records of
+ *
+ * timestamp (int64, ms) | module (int32) | level (int32) | id length (uint16) | location length (uint16) |
+ * message length (uint16) | id | location | message
+ *
+ * with all integers little endian and strings not terminated.
+ */
+struct LogRecordFormat
+{
+    static const uint8_t header[8];
+
+    static const size_t fixed_record_size = 8 + 4 + 4 + 2 + 2 + 2;
+
+    // prints a line in the same format as ConsoleLogger
+    static void Print(std::ostream& output,
+                      int64_t timestamp,
+                      LogLevel level,
+                      const char* id,
+                      const char* location,
+                      const char* message,
+                      bool printLocation);
+
+    // @return the number of bytes written to dest, which must hold fixed_record_size plus the string lengths
+    static size_t Write(uint8_t* dest,
+                        int64_t timestamp,
+                        ModuleId module,
+                        LogLevel level,
+                        const char* id,
+                        uint16_t idLength,
+                        const char* location,
+                        uint16_t locationLength,
+                        const char* message,
+                        uint16_t messageLength);
+};
+
+} // namespace opendnp3
+
+#endif
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "opendnp3/master/BatchSOEHandler.h"
+
+#include "app/parsing/MeasurementCollection.h"
+
+namespace opendnp3
+{
+
+void BatchSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values)
+{
+    this->Deliver(info, values, this->bools);
+}
+
+void BatchSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values)
+{
+    this->Deliver(info, values, this->doubleBits);
+}
+
+void BatchSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values)
+{
+    this->Deliver(info, values, this->doubles);
+}
+
+void BatchSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values)
+{
+    this->Deliver(info, values, this->counts);
+}
+
+void BatchSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values)
+{
+    this->Deliver(info, values, this->counts);
+}
+
+void BatchSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values)
+{
+    this->Deliver(info, values, this->bools);
+}
+
+void BatchSOEHandler::Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values)
+{
+    this->Deliver(info, values, this->doubles);
+}
+
+template<class T>
+void BatchSOEHandler::Deliver(const HeaderInfo& info,
+                              const ICollection<Indexed<T>>& values,
+                              Column<typename T::Type>& column)
+{
+    const auto count = values.Count();
+
+    auto indices = this->indices.Reserve(count);
+    auto data = column.Reserve(count);
+    auto flags = this->flags.Reserve(count);
+
+    // headers w/o timestamps don't get a column of invalid times
+    DNPTime* times = nullptr;
+    if (info.tsquality != TimestampQuality::INVALID)
+    {
+        times = this->times.Reserve(count);
+    }
+
+    const MeasurementColumns<T> columns(indices, data, flags, times);
+
+    // collections decoded from the APDU fill the columns in a single call, others (e.g. w/ a CTO applied) are visited
+    const auto measurements = dynamic_cast<const IMeasurementCollection<T>*>(&values);
+    if (measurements)
+    {
+        measurements->CopyTo(columns);
+    }
+    else
+    {
+        size_t pos = 0;
+        values.ForeachItem([&columns, &pos](const Indexed<T>& item) { columns.Set(pos++, item); });
+    }
+
+    this->ProcessBatch(info, MeasurementBatch<T>(count, indices, data, flags, times));
+}
+
+} // namespace opendnp3
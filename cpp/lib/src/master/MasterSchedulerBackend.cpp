@@ -130,32 +130,39 @@ bool MasterSchedulerBackend::CheckForTaskRun()
 
     this->taskCheckPending = false;
 
-    this->RestartTimeoutTimer();
-
-    if (this->current)
-        return false;
-
     const auto now = Timestamp(this->executor->get_time());
 
-    // try to find a task that can run
-    auto current = this->tasks.begin();
-    auto best_task = current;
-    if (current == this->tasks.end())
-        return false;
-    ++current;
+    // a single pass finds both the best task and the earliest start timeout
+    auto minStartExpiration = Timestamp::Max();
+    auto best_task = this->tasks.end();
+    Key best_key;
 
-    while (current != this->tasks.end())
+    for (auto record = this->tasks.begin(); record != this->tasks.end(); ++record)
     {
-        if (GetBestTaskToRun(now, *best_task, *current) == Comparison::RIGHT)
+        if (!record->task->IsRecurring() && (record->task->StartExpirationTime() < minStartExpiration))
         {
-            best_task = current;
+            minStartExpiration = record->task->StartExpirationTime();
         }
 
-        ++current;
+        if (this->current)
+            continue;
+
+        // ties go to the task that was added first
+        const Key key(now, *record->task);
+        if (best_task == this->tasks.end() || key.IsBetterThan(best_key))
+        {
+            best_task = record;
+            best_key = key;
+        }
     }
 
+    this->RestartTimeoutTimer(minStartExpiration);
+
+    if (this->current || best_task == this->tasks.end())
+        return false;
+
     // is the task runnable now?
-    const auto is_expired = now >= best_task->task->ExpirationTime();
+    const auto is_expired = now >= best_key.expiration;
     if (is_expired)
     {
         this->current = *best_task;
@@ -165,14 +172,27 @@ bool MasterSchedulerBackend::CheckForTaskRun()
         return true;
     }
 
-    auto callback = [this, self = shared_from_this()]() { this->CheckForTaskRun(); };
-
-    this->taskTimer.cancel();
-    this->taskTimer = this->executor->start(best_task->task->ExpirationTime().value, callback);
+    this->StartTaskTimer(best_key.expiration);
 
     return false;
 }
 
+void MasterSchedulerBackend::StartTaskTimer(const Timestamp& expiration)
+{
+    // a timer that is already due first is kept, it re-evaluates when it fires
+    if (this->taskTimerExpiration.is_set() && this->taskTimerExpiration.get() <= expiration)
+        return;
+
+    auto callback = [this, self = shared_from_this()]() {
+        this->taskTimerExpiration.clear();
+        this->CheckForTaskRun();
+    };
+
+    this->taskTimer.cancel();
+    this->taskTimer = this->executor->start(expiration.value, callback);
+    this->taskTimerExpiration.set(expiration);
+}
+
 void MasterSchedulerBackend::RestartTimeoutTimer()
 {
     if (this->isShutdown)
@@ -188,13 +208,23 @@ void MasterSchedulerBackend::RestartTimeoutTimer()
         }
     }
 
+    this->RestartTimeoutTimer(min);
+}
+
+void MasterSchedulerBackend::RestartTimeoutTimer(const Timestamp& minStartExpiration)
+{
+    // a timer that is already due first is kept, TimeoutTasks only times out what has expired
+    if (minStartExpiration == Timestamp::Max() || this->taskStartTimeoutExpiration <= minStartExpiration)
+        return;
+
+    auto callback = [this, self = shared_from_this()]() {
+        this->taskStartTimeoutExpiration = Timestamp::Max();
+        this->TimeoutTasks();
+    };
+
     this->taskStartTimeout.cancel();
-    if (min != Timestamp::Max())
-    {
-        this->taskStartTimeout.cancel();
-        this->taskStartTimeout
-            = this->executor->start(min.value, [this, self = shared_from_this()]() { this->TimeoutTasks(); });
-    }
+    this->taskStartTimeout = this->executor->start(minStartExpiration.value, callback);
+    this->taskStartTimeoutExpiration = minStartExpiration;
 }
 
 void MasterSchedulerBackend::TimeoutTasks()
@@ -220,96 +250,31 @@ void MasterSchedulerBackend::TimeoutTasks()
     this->RestartTimeoutTimer();
 }
 
-MasterSchedulerBackend::Comparison MasterSchedulerBackend::GetBestTaskToRun(const Timestamp& now,
-                                                                            const Record& left,
-                                                                            const Record& right)
-{
-    const auto BEST_ENABLED_STATUS = CompareEnabledStatus(left, right);
-
-    if (BEST_ENABLED_STATUS != Comparison::SAME)
-    {
-        // if one task is disabled, return the other task
-        return BEST_ENABLED_STATUS;
-    }
-
-    const auto BEST_BLOCKED_STATUS = CompareBlockedStatus(left, right);
-
-    if (BEST_BLOCKED_STATUS != Comparison::SAME)
-    {
-        // if one task is blocked and the other isn't, return the unblocked task
-        return BEST_BLOCKED_STATUS;
-    }
-
-    const auto EARLIEST_EXPIRATION = CompareTime(now, left, right);
-    const auto BEST_PRIORITY = ComparePriority(left, right);
-
-    // if the expiration times are the same, break based on priority, otherwise go with the expiration time
-    return (EARLIEST_EXPIRATION == Comparison::SAME) ? BEST_PRIORITY : EARLIEST_EXPIRATION;
-}
-
-MasterSchedulerBackend::Comparison MasterSchedulerBackend::CompareTime(const Timestamp& now,
-                                                                       const Record& left,
-                                                                       const Record& right)
+MasterSchedulerBackend::Key::Key(const Timestamp& now, const IMasterTask& task)
+    : expiration(task.ExpirationTime()),
+      disabled(expiration == Timestamp::Max()),
+      blocked(task.IsBlocked()),
+      // if a task is already expired, the effective expiration time is NOW
+      effectiveTime((now >= expiration) ? now : expiration),
+      priority(task.Priority())
 {
-    // if tasks are already expired, the effective expiration time is NOW
-    const auto leftTime = left.task->IsExpired(now) ? now : left.task->ExpirationTime();
-    const auto rightTime = right.task->IsExpired(now) ? now : right.task->ExpirationTime();
-
-    if (leftTime < rightTime)
-    {
-        return Comparison::LEFT;
-    }
-    if (rightTime < leftTime)
-    {
-        return Comparison::RIGHT;
-    }
-    else
-    {
-        return Comparison::SAME;
-    }
 }
 
-MasterSchedulerBackend::Comparison MasterSchedulerBackend::CompareEnabledStatus(const Record& left, const Record& right)
+bool MasterSchedulerBackend::Key::IsBetterThan(const Key& other) const
 {
-    if (left.task->ExpirationTime() == Timestamp::Max()) // left is disabled, check the right
-    {
-        return right.task->ExpirationTime() == Timestamp::Max() ? Comparison::SAME : Comparison::RIGHT;
-    }
-    if (right.task->ExpirationTime() == Timestamp::Max()) // left is enabled, right is disabled
-    {
-        return Comparison::LEFT;
-    }
-    else
-    {
-        // both tasks are enabled
-        return Comparison::SAME;
-    }
-}
+    // if one task is disabled, prefer the other task
+    if (this->disabled != other.disabled)
+        return other.disabled;
 
-MasterSchedulerBackend::Comparison MasterSchedulerBackend::CompareBlockedStatus(const Record& left, const Record& right)
-{
-    if (left.task->IsBlocked())
-    {
-        return right.task->IsBlocked() ? Comparison::SAME : Comparison::RIGHT;
-    }
+    // if one task is blocked and the other isn't, prefer the unblocked task
+    if (this->blocked != other.blocked)
+        return other.blocked;
 
-    return right.task->IsBlocked() ? Comparison::LEFT : Comparison::SAME;
-}
+    // if the expiration times are the same, break based on priority, otherwise go with the expiration time
+    if (!(this->effectiveTime == other.effectiveTime))
+        return this->effectiveTime < other.effectiveTime;
 
-MasterSchedulerBackend::Comparison MasterSchedulerBackend::ComparePriority(const Record& left, const Record& right)
-{
-    if (left.task->Priority() < right.task->Priority())
-    {
-        return Comparison::LEFT;
-    }
-    if (right.task->Priority() < left.task->Priority())
-    {
-        return Comparison::RIGHT;
-    }
-    else
-    {
-        return Comparison::SAME;
-    }
+    return this->priority < other.priority;
 }
 
 } // namespace opendnp3
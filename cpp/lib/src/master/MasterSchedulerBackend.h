@@ -24,6 +24,7 @@
 #include "master/IMasterTaskRunner.h"
 
 #include <exe4cpp/Timer.h>
+#include <ser4cpp/container/Settable.h>
 
 #include <memory>
 #include <vector>
@@ -92,28 +93,36 @@ private:
 
     void RestartTimeoutTimer();
 
+    void RestartTimeoutTimer(const Timestamp& minStartExpiration);
+
+    void StartTaskTimer(const Timestamp& expiration);
+
     void TimeoutTasks();
 
     std::shared_ptr<exe4cpp::IExecutor> executor;
+
+    // timers are only restarted when they need to fire earlier, a timer that fires early just re-evaluates
     exe4cpp::Timer taskTimer;
+    ser4cpp::Settable<Timestamp> taskTimerExpiration;
     exe4cpp::Timer taskStartTimeout;
+    Timestamp taskStartTimeoutExpiration = Timestamp::Max();
 
-    enum class Comparison : uint8_t
+    // The state a task is scheduled by, read once per evaluation. Tasks compare by enabled status, then
+    // blocked status, then expiration time where expired tasks count as expiring now, then priority.
+    struct Key
     {
-        LEFT,
-        RIGHT,
-        SAME
-    };
+        Key() = default;
 
-    static Comparison GetBestTaskToRun(const Timestamp& now, const Record& left, const Record& right);
+        Key(const Timestamp& now, const IMasterTask& task);
 
-    static Comparison CompareEnabledStatus(const Record& left, const Record& right);
+        bool IsBetterThan(const Key& other) const;
 
-    static Comparison CompareBlockedStatus(const Record& left, const Record& right);
-
-    static Comparison ComparePriority(const Record& left, const Record& right);
-
-    static Comparison CompareTime(const Timestamp& now, const Record& left, const Record& right);
+        Timestamp expiration;
+        bool disabled = false;
+        bool blocked = false;
+        Timestamp effectiveTime;
+        int priority = 0;
+    };
 };
 
 } // namespace opendnp3
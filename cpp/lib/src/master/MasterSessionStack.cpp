@@ -80,6 +80,11 @@ bool MasterSessionStack::OnFrame(const LinkHeaderFields& header, const ser4cpp::
     return stack.link->OnFrame(header, userdata);
 }
 
+ser4cpp::wseq_t MasterSessionStack::GetUserDataBuffer(size_t length)
+{
+    return stack.transport->GetSegmentBuffer(length);
+}
+
 void MasterSessionStack::OnTxReady()
 {
     this->stack.link->OnTxReady();
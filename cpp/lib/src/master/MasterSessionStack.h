@@ -57,6 +57,8 @@ public:
 
     bool OnFrame(const LinkHeaderFields& header, const ser4cpp::rseq_t& userdata);
 
+    ser4cpp::wseq_t GetUserDataBuffer(size_t length);
+
     void OnTxReady();
 
     void SetLogFilters(const opendnp3::LogLevels& filters) final;
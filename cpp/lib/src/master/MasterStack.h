@@ -97,6 +97,11 @@ public:
         return this->tstack.link->OnFrame(header, userdata);
     }
 
+    ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) override
+    {
+        return this->tstack.transport->GetSegmentBuffer(length);
+    }
+
     void BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& context) override
     {
         this->iohandler->BeginTransmit(shared_from_this(), buffer);
@@ -0,0 +1,285 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "opendnp3/master/MeasurementCache.h"
+
+#include "app/parsing/Collections.h"
+
+#include <cstring>
+
+namespace opendnp3
+{
+
+namespace
+{
+    template<class V> bool IsSameValue(const V& lhs, const V& rhs)
+    {
+        return lhs == rhs;
+    }
+
+    // compared bit for bit so that a point that stays at NaN is unchanged
+    bool IsSameValue(double lhs, double rhs)
+    {
+        return std::memcmp(&lhs, &rhs, sizeof(double)) == 0;
+    }
+} // namespace
+
+MeasurementCache::MeasurementCache(std::shared_ptr<ISOEHandler> handler, Unchanged unchanged)
+    : handler(std::move(handler)), unchanged(unchanged)
+{
+}
+
+bool MeasurementCache::Get(uint16_t index, Binary& value) const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->binaries.Get(index, value);
+}
+
+bool MeasurementCache::Get(uint16_t index, DoubleBitBinary& value) const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->doubleBitBinaries.Get(index, value);
+}
+
+bool MeasurementCache::Get(uint16_t index, Analog& value) const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->analogs.Get(index, value);
+}
+
+bool MeasurementCache::Get(uint16_t index, Counter& value) const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->counters.Get(index, value);
+}
+
+bool MeasurementCache::Get(uint16_t index, FrozenCounter& value) const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->frozenCounters.Get(index, value);
+}
+
+bool MeasurementCache::Get(uint16_t index, BinaryOutputStatus& value) const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->binaryOutputStatii.Get(index, value);
+}
+
+bool MeasurementCache::Get(uint16_t index, AnalogOutputStatus& value) const
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->analogOutputStatii.Get(index, value);
+}
+
+MeasurementSnapshot MeasurementCache::Snapshot() const
+{
+    MeasurementSnapshot snapshot;
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->binaries.CopyTo(snapshot.binaries);
+    this->doubleBitBinaries.CopyTo(snapshot.doubleBitBinaries);
+    this->analogs.CopyTo(snapshot.analogs);
+    this->counters.CopyTo(snapshot.counters);
+    this->frozenCounters.CopyTo(snapshot.frozenCounters);
+    this->binaryOutputStatii.CopyTo(snapshot.binaryOutputStatii);
+    this->analogOutputStatii.CopyTo(snapshot.analogOutputStatii);
+
+    return snapshot;
+}
+
+void MeasurementCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->binaries.Clear();
+    this->doubleBitBinaries.Clear();
+    this->analogs.Clear();
+    this->counters.Clear();
+    this->frozenCounters.Clear();
+    this->binaryOutputStatii.Clear();
+    this->analogOutputStatii.Clear();
+}
+
+void MeasurementCache::BeginFragment(const ResponseInfo& info)
+{
+    this->handler->BeginFragment(info);
+}
+
+void MeasurementCache::EndFragment(const ResponseInfo& info)
+{
+    this->handler->EndFragment(info);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values)
+{
+    this->Filter(info, values, this->binaries);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values)
+{
+    this->Filter(info, values, this->doubleBitBinaries);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values)
+{
+    this->Filter(info, values, this->analogs);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values)
+{
+    this->Filter(info, values, this->counters);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values)
+{
+    this->Filter(info, values, this->frozenCounters);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values)
+{
+    this->Filter(info, values, this->binaryOutputStatii);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values)
+{
+    this->Filter(info, values, this->analogOutputStatii);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values)
+{
+    this->handler->Process(info, values);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values)
+{
+    this->handler->Process(info, values);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values)
+{
+    this->handler->Process(info, values);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values)
+{
+    this->handler->Process(info, values);
+}
+
+void MeasurementCache::Process(const HeaderInfo& info, const ICollection<DNPTime>& values)
+{
+    this->handler->Process(info, values);
+}
+
+template<class T>
+void MeasurementCache::Filter(const HeaderInfo& info, const ICollection<Indexed<T>>& values, Table<T>& table)
+{
+    if (info.isEventVariation)
+    {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            values.ForeachItem([&table](const Indexed<T>& item) { table.Update(item); });
+        }
+
+        this->handler->Process(info, values);
+        return;
+    }
+
+    table.changed.clear();
+    table.unchanged.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        values.ForeachItem([&table](const Indexed<T>& item) {
+            if (table.Update(item))
+            {
+                table.changed.push_back(item);
+            }
+            else
+            {
+                table.unchanged.push_back(item);
+            }
+        });
+    }
+
+    // the handler is called w/o the lock so that it may query the cache
+    if (table.unchanged.empty())
+    {
+        this->handler->Process(info, values);
+        return;
+    }
+
+    if (!table.changed.empty())
+    {
+        this->handler->Process(info, ArrayCollection<Indexed<T>>(table.changed.data(), table.changed.size()));
+    }
+
+    if (this->unchanged == Unchanged::Flag)
+    {
+        auto flagged = info;
+        flagged.isUnchanged = true;
+        this->handler->Process(flagged,
+                               ArrayCollection<Indexed<T>>(table.unchanged.data(), table.unchanged.size()));
+    }
+}
+
+template<class T> bool MeasurementCache::Table<T>::Update(const Indexed<T>& item)
+{
+    if (item.index >= this->entries.size())
+    {
+        this->entries.resize(item.index + 1);
+    }
+
+    auto& entry = this->entries[item.index];
+
+    const bool same = entry.present && IsSameValue(entry.value.value, item.value.value)
+        && (entry.value.flags.value == item.value.flags.value);
+
+    entry.value = item.value;
+    entry.present = true;
+
+    return !same;
+}
+
+template<class T> bool MeasurementCache::Table<T>::Get(uint16_t index, T& value) const
+{
+    if (index >= this->entries.size() || !this->entries[index].present)
+    {
+        return false;
+    }
+
+    value = this->entries[index].value;
+    return true;
+}
+
+template<class T> void MeasurementCache::Table<T>::CopyTo(std::vector<Indexed<T>>& dest) const
+{
+    for (size_t i = 0; i < this->entries.size(); ++i)
+    {
+        if (this->entries[i].present)
+        {
+            dest.emplace_back(this->entries[i].value, static_cast<uint16_t>(i));
+        }
+    }
+}
+
+template<class T> void MeasurementCache::Table<T>::Clear()
+{
+    this->entries.clear();
+}
+
+} // namespace opendnp3
@@ -79,7 +79,8 @@ template<class Spec> bool load_type(StaticDataMap<Spec>& map, HeaderWriter& writ
 Database::Database(const DatabaseConfig& config,
                    IEventReceiver& event_receiver,
                    IDnpTimeSource& time_source,
-                   StaticTypeBitField allowed_class_zero_types)
+                   StaticTypeBitField allowed_class_zero_types,
+                   bool coalesce_static_updates)
     : event_receiver(event_receiver),
       time_source(time_source),
       allowed_class_zero_types(allowed_class_zero_types),
@@ -93,6 +94,14 @@ Database::Database(const DatabaseConfig& config,
       time_and_interval(config.time_and_interval),
       octet_string(config.octet_string)
 {
+    this->binary_input.set_coalescing(coalesce_static_updates);
+    this->double_binary.set_coalescing(coalesce_static_updates);
+    this->analog_input.set_coalescing(coalesce_static_updates);
+    this->counter.set_coalescing(coalesce_static_updates);
+    this->frozen_counter.set_coalescing(coalesce_static_updates);
+    this->binary_output_status.set_coalescing(coalesce_static_updates);
+    this->analog_output_status.set_coalescing(coalesce_static_updates);
+    this->octet_string.set_coalescing(coalesce_static_updates);
 }
 
 IINField Database::SelectAll(GroupVariation gv)
@@ -540,6 +549,67 @@ bool Database::FreezeSelectedCounters(bool clear, EventMode mode)
     return true;
 }
 
+void Database::Apply(const UpdateBatch& batch)
+{
+    batch.ForEachRun([this](const auto* records, size_t count) { this->apply_records(records, count); });
+}
+
+void Database::apply_records(const UpdateBatch::Record<Binary>* records, size_t count)
+{
+    this->binary_input.update(records, count, this->event_receiver);
+}
+
+void Database::apply_records(const UpdateBatch::Record<DoubleBitBinary>* records, size_t count)
+{
+    this->double_binary.update(records, count, this->event_receiver);
+}
+
+void Database::apply_records(const UpdateBatch::Record<Analog>* records, size_t count)
+{
+    this->analog_input.update(records, count, this->event_receiver);
+}
+
+void Database::apply_records(const UpdateBatch::Record<Counter>* records, size_t count)
+{
+    this->counter.update(records, count, this->event_receiver);
+}
+
+void Database::apply_records(const UpdateBatch::FreezeRecord* records, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        this->FreezeCounter(records[i].index, records[i].clear, records[i].mode);
+    }
+}
+
+void Database::apply_records(const UpdateBatch::Record<BinaryOutputStatus>* records, size_t count)
+{
+    this->binary_output_status.update(records, count, this->event_receiver);
+}
+
+void Database::apply_records(const UpdateBatch::Record<AnalogOutputStatus>* records, size_t count)
+{
+    this->analog_output_status.update(records, count, this->event_receiver);
+}
+
+void Database::apply_records(const UpdateBatch::Record<OctetString>* records, size_t count)
+{
+    this->octet_string.update(records, count, this->event_receiver);
+}
+
+void Database::apply_records(const UpdateBatch::Record<TimeAndInterval>* records, size_t count)
+{
+    this->time_and_interval.update(records, count, this->event_receiver);
+}
+
+void Database::apply_records(const UpdateBatch::ModifyRecord* records, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        this->Modify(records[i].type, records[i].start, records[i].stop, records[i].flags);
+    }
+}
+
 template<class Spec> void Database::select_all_class_zero(StaticDataMap<Spec>& map)
 {
     if (this->allowed_class_zero_types.IsSet(Spec::StaticTypeEnum))
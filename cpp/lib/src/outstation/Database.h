@@ -32,6 +32,7 @@
 #include "opendnp3/outstation/IDnpTimeSource.h"
 #include "opendnp3/outstation/IUpdateHandler.h"
 #include "opendnp3/outstation/StaticTypeBitfield.h"
+#include "opendnp3/outstation/UpdateBatch.h"
 
 namespace opendnp3
 {
@@ -42,7 +43,8 @@ public:
     Database(const DatabaseConfig& config,
              IEventReceiver& event_receiver,
              IDnpTimeSource& time_source,
-             StaticTypeBitField allowed_class_zero_types);
+             StaticTypeBitField allowed_class_zero_types,
+             bool coalesce_static_updates = false);
 
     // ------- IStaticSelector -------------
     IINField SelectAll(GroupVariation gv) override;
@@ -72,6 +74,9 @@ public:
 
     bool FreezeSelectedCounters(bool clear, EventMode mode = EventMode::Detect);
 
+    // apply a batch of updates in a single pass over each run of records
+    void Apply(const UpdateBatch& batch);
+
 private:
     IEventReceiver& event_receiver;
     IDnpTimeSource& time_source;
@@ -89,6 +94,17 @@ private:
 
     // ----- helper methods ------
 
+    void apply_records(const UpdateBatch::Record<Binary>* records, size_t count);
+    void apply_records(const UpdateBatch::Record<DoubleBitBinary>* records, size_t count);
+    void apply_records(const UpdateBatch::Record<Analog>* records, size_t count);
+    void apply_records(const UpdateBatch::Record<Counter>* records, size_t count);
+    void apply_records(const UpdateBatch::FreezeRecord* records, size_t count);
+    void apply_records(const UpdateBatch::Record<BinaryOutputStatus>* records, size_t count);
+    void apply_records(const UpdateBatch::Record<AnalogOutputStatus>* records, size_t count);
+    void apply_records(const UpdateBatch::Record<OctetString>* records, size_t count);
+    void apply_records(const UpdateBatch::Record<TimeAndInterval>* records, size_t count);
+    void apply_records(const UpdateBatch::ModifyRecord* records, size_t count);
+
     template<class Spec> void select_all_class_zero(StaticDataMap<Spec>& map);
 
     template<class Spec> static IINField select_all(StaticDataMap<Spec>& map);
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OctetArena.h"
+
+#include <cstring>
+
+namespace opendnp3
+{
+
+OctetArena::handle_t OctetArena::Allocate(const Buffer& data)
+{
+    const auto size_class = GetSizeClassForLength(data.length);
+    auto& sc = this->classes[size_class];
+
+    if (sc.free_chunks.empty())
+    {
+        // grow by a whole slab
+        const auto first = static_cast<uint32_t>(sc.bytes.size() / ChunkSize(size_class));
+        sc.bytes.resize(sc.bytes.size() + chunks_per_slab * ChunkSize(size_class));
+        for (auto chunk = static_cast<uint32_t>(first + chunks_per_slab); chunk > first; --chunk)
+        {
+            sc.free_chunks.push_back(chunk - 1);
+        }
+    }
+
+    const auto chunk = sc.free_chunks.back();
+    sc.free_chunks.pop_back();
+
+    const auto handle = MakeHandle(size_class, chunk);
+    Write(this->Chunk(handle), data);
+    return handle;
+}
+
+OctetArena::handle_t OctetArena::Replace(handle_t handle, const Buffer& data)
+{
+    if (GetSizeClass(handle) == GetSizeClassForLength(data.length))
+    {
+        Write(this->Chunk(handle), data);
+        return handle;
+    }
+
+    this->Free(handle);
+    return this->Allocate(data);
+}
+
+void OctetArena::Free(handle_t handle)
+{
+    this->classes[GetSizeClass(handle)].free_chunks.push_back(handle >> size_class_bits);
+}
+
+Buffer OctetArena::Get(handle_t handle) const
+{
+    const auto chunk = this->Chunk(handle);
+    return Buffer(chunk + 1, chunk[0]);
+}
+
+size_t OctetArena::Capacity() const
+{
+    size_t total = 0;
+    for (const auto& sc : this->classes)
+    {
+        total += sc.bytes.size();
+    }
+    return total;
+}
+
+uint8_t OctetArena::GetSizeClassForLength(size_t length)
+{
+    // the chunk also holds the length byte
+    const auto required = (length > OctetData::MAX_SIZE ? OctetData::MAX_SIZE : length) + 1;
+
+    uint8_t size_class = 0;
+    while (ChunkSize(size_class) < required)
+    {
+        ++size_class;
+    }
+    return size_class;
+}
+
+uint8_t* OctetArena::Chunk(handle_t handle)
+{
+    return const_cast<uint8_t*>(static_cast<const OctetArena*>(this)->Chunk(handle));
+}
+
+const uint8_t* OctetArena::Chunk(handle_t handle) const
+{
+    const auto size_class = GetSizeClass(handle);
+    return this->classes[size_class].bytes.data() + (handle >> size_class_bits) * ChunkSize(size_class);
+}
+
+void OctetArena::Write(uint8_t* chunk, const Buffer& data)
+{
+    const auto length = static_cast<uint8_t>(data.length > OctetData::MAX_SIZE ? OctetData::MAX_SIZE : data.length);
+    chunk[0] = length;
+    if (length > 0)
+    {
+        memcpy(chunk + 1, data.data, length);
+    }
+}
+
+} // namespace opendnp3
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_OCTETARENA_H
+#define OPENDNP3_OCTETARENA_H
+
+#include "opendnp3/app/OctetData.h"
+#include "opendnp3/util/Buffer.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * Slab storage for octet strings that only holds (roughly) their actual length
+ *
+ * Each string is stored as a length byte followed by its data in a chunk of the smallest size class that fits,
+ * from 8 to 256 bytes. Every size class grows a slab of chunks at a time and recycles freed chunks, so a
+ * 4 byte string costs 8 bytes instead of the 256 bytes of an OctetData.
+ */
+class OctetArena : private Uncopyable
+{
+public:
+    using handle_t = uint32_t;
+
+    OctetArena() = default;
+
+    // copy the data into a new chunk, truncating it to OctetData::MAX_SIZE. The data must not point into the arena.
+    handle_t Allocate(const Buffer& data);
+
+    // @return the handle to use for the new data, which reuses the chunk if the size class doesn't change
+    handle_t Replace(handle_t handle, const Buffer& data);
+
+    void Free(handle_t handle);
+
+    // @return a view of the data that is valid until the arena is next modified
+    Buffer Get(handle_t handle) const;
+
+    // @return the total number of bytes held in slabs
+    size_t Capacity() const;
+
+private:
+    static constexpr uint8_t num_size_classes = 6;
+    static constexpr size_t min_chunk_size = 8;
+    static constexpr size_t chunks_per_slab = 32;
+    static constexpr uint8_t size_class_bits = 3;
+
+    static uint8_t GetSizeClassForLength(size_t length);
+
+    static uint8_t GetSizeClass(handle_t handle)
+    {
+        return static_cast<uint8_t>(handle & ((1 << size_class_bits) - 1));
+    }
+
+    static size_t ChunkSize(uint8_t size_class)
+    {
+        return min_chunk_size << size_class;
+    }
+
+    static handle_t MakeHandle(uint8_t size_class, uint32_t chunk)
+    {
+        return (chunk << size_class_bits) | size_class;
+    }
+
+    uint8_t* Chunk(handle_t handle);
+    const uint8_t* Chunk(handle_t handle) const;
+
+    static void Write(uint8_t* chunk, const Buffer& data);
+
+    struct SizeClass
+    {
+        std::vector<uint8_t> bytes;
+        std::vector<uint32_t> free_chunks;
+    };
+
+    SizeClass classes[num_size_classes];
+};
+
+} // namespace opendnp3
+
+#endif
@@ -59,7 +59,11 @@ OContext::OContext(const Addresses& addresses,
       commandHandler(std::move(commandHandler)),
       application(std::move(application)),
       eventBuffer(config.eventBufferConfig),
-      database(db_config, eventBuffer, *this->application, config.params.typesAllowedInClass0),
+      database(db_config,
+               eventBuffer,
+               *this->application,
+               config.params.typesAllowedInClass0,
+               config.params.coalesceStaticUpdates),
       rspContext(database, eventBuffer),
       params(config.params),
       isOnline(false),
@@ -553,6 +557,11 @@ IUpdateHandler& OContext::GetUpdateHandler()
     return this->database;
 }
 
+void OContext::ApplyUpdates(const UpdateBatch& batch)
+{
+    this->database.Apply(batch);
+}
+
 //// ----------------------------- function handlers -----------------------------
 
 bool OContext::ProcessBroadcastRequest(const ParsedRequest& request)
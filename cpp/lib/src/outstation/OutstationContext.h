@@ -84,6 +84,8 @@ public:
 
     IUpdateHandler& GetUpdateHandler();
 
+    void ApplyUpdates(const UpdateBatch& batch);
+
     void SetRestartIIN();
 
 private:
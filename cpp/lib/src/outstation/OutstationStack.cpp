@@ -45,7 +45,10 @@ OutstationStack::OutstationStack(const Logger& logger,
                executor,
                tstack.transport,
                commandHandler,
-               application)
+               application),
+      updateQueue(config.outstation.params.updateQueueSize > 0
+                      ? std::make_unique<UpdateQueue>(config.outstation.params.updateQueueSize)
+                      : nullptr)
 {
     this->tstack.transport->SetAppLayer(ocontext);
 }
@@ -91,12 +94,63 @@ void OutstationStack::Apply(const Updates& updates)
     if (updates.IsEmpty())
         return;
 
+    if (this->updateQueue)
+    {
+        // updates that don't fit in the ring are queued behind it so that they are applied in order
+        this->updateQueue->Push(updates);
+        this->ScheduleDrain();
+        return;
+    }
+
     auto task = [self = this->shared_from_this(), updates]() {
-        updates.Apply(self->ocontext.GetUpdateHandler());
+        self->ocontext.ApplyUpdates(*updates.GetBatch());
         self->ocontext.HandleNewEvents(); // force the outstation to check for updates
     };
 
     this->executor->post(task);
 }
 
+bool OutstationStack::TryApply(const Updates& updates)
+{
+    if (!this->updateQueue)
+    {
+        this->Apply(updates);
+        return true;
+    }
+
+    if (updates.IsEmpty())
+        return true;
+
+    if (!this->updateQueue->TryPush(updates))
+        return false;
+
+    this->ScheduleDrain();
+    return true;
+}
+
+void OutstationStack::ScheduleDrain()
+{
+    // only one drain is ever scheduled no matter how many producers push before it runs
+    if (this->updateQueue->RequestDrain())
+    {
+        auto task = [self = this->shared_from_this()]() {
+            if (self->DrainUpdateQueue() > 0)
+            {
+                self->ocontext.HandleNewEvents(); // force the outstation to check for updates
+            }
+        };
+
+        this->executor->post(task);
+    }
+}
+
+size_t OutstationStack::DrainUpdateQueue()
+{
+    if (!this->updateQueue)
+        return 0;
+
+    auto apply = [this](const Updates& updates) { this->ocontext.ApplyUpdates(*updates.GetBatch()); };
+    return this->updateQueue->Drain(apply);
+}
+
 } // namespace opendnp3
@@ -23,6 +23,7 @@
 #include "StackBase.h"
 #include "channel/IOHandler.h"
 #include "outstation/OutstationContext.h"
+#include "outstation/UpdateQueue.h"
 #include "transport/TransportStack.h"
 
 #include "opendnp3/outstation/IOutstation.h"
@@ -99,6 +100,11 @@ public:
         return this->tstack.link->OnFrame(header, userdata);
     }
 
+    ser4cpp::wseq_t GetUserDataBuffer(const LinkHeaderFields& header, size_t length) final
+    {
+        return this->tstack.transport->GetSegmentBuffer(length);
+    }
+
     void BeginTransmit(const ser4cpp::rseq_t& buffer, ILinkSession& context) final
     {
         this->iohandler->BeginTransmit(shared_from_this(), buffer);
@@ -112,8 +118,17 @@ public:
 
     void Apply(const Updates& updates) final;
 
+    bool TryApply(const Updates& updates) final;
+
 private:
+    // post a drain of the update queue unless one is already pending
+    void ScheduleDrain();
+
+    // apply everything in the update queue, returns the number of entries applied
+    size_t DrainUpdateQueue();
+
     OContext ocontext;
+    std::unique_ptr<UpdateQueue> updateQueue;
 };
 
 } // namespace opendnp3
@@ -0,0 +1,195 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_SLOTBITSET_H
+#define OPENDNP3_SLOTBITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+namespace opendnp3
+{
+
+/**
+ * A dynamically sized set of bits addressed by slot number
+ *
+ * Bulk operations and searches for the next set bit are performed a 64-bit word at a time.
+ */
+class SlotBitset
+{
+    using word_t = uint64_t;
+    static constexpr size_t bits_per_word = 64;
+
+public:
+    size_t size() const
+    {
+        return this->num_bits;
+    }
+
+    void resize(size_t num_bits)
+    {
+        this->num_bits = num_bits;
+        this->words.resize((num_bits + bits_per_word - 1) / bits_per_word, 0);
+        this->mask_last_word();
+    }
+
+    bool test(size_t pos) const
+    {
+        return (this->words[pos / bits_per_word] & bit(pos)) != 0;
+    }
+
+    void set(size_t pos)
+    {
+        this->words[pos / bits_per_word] |= bit(pos);
+    }
+
+    void reset(size_t pos)
+    {
+        this->words[pos / bits_per_word] &= ~bit(pos);
+    }
+
+    void set_all()
+    {
+        for (auto& word : this->words)
+        {
+            word = ~word_t(0);
+        }
+        this->mask_last_word();
+    }
+
+    void reset_all()
+    {
+        for (auto& word : this->words)
+        {
+            word = 0;
+        }
+    }
+
+    bool any() const
+    {
+        for (auto word : this->words)
+        {
+            if (word)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // set every bit in the half-open interval [begin, end)
+    void set_range(size_t begin, size_t end)
+    {
+        while (begin < end)
+        {
+            const auto offset = begin % bits_per_word;
+            const auto count = (end - begin) < (bits_per_word - offset) ? (end - begin) : (bits_per_word - offset);
+            const auto mask = (count == bits_per_word) ? ~word_t(0) : (((word_t(1) << count) - 1) << offset);
+            this->words[begin / bits_per_word] |= mask;
+            begin += count;
+        }
+    }
+
+    // insert an unset bit at the specified position, shifting all bits at or above it up by one
+    void insert(size_t pos)
+    {
+        this->resize(this->num_bits + 1);
+        for (auto i = this->num_bits - 1; i > pos; --i)
+        {
+            if (this->test(i - 1))
+            {
+                this->set(i);
+            }
+            else
+            {
+                this->reset(i);
+            }
+        }
+        this->reset(pos);
+    }
+
+    // @return the position of the first set bit >= pos, or size() if there is none
+    size_t find_next(size_t pos) const
+    {
+        if (pos >= this->num_bits)
+        {
+            return this->num_bits;
+        }
+
+        auto index = pos / bits_per_word;
+        auto word = this->words[index] & (~word_t(0) << (pos % bits_per_word));
+
+        while (word == 0)
+        {
+            if (++index == this->words.size())
+            {
+                return this->num_bits;
+            }
+            word = this->words[index];
+        }
+
+        return index * bits_per_word + count_trailing_zeros(word);
+    }
+
+private:
+    std::vector<word_t> words;
+    size_t num_bits = 0;
+
+    static word_t bit(size_t pos)
+    {
+        return word_t(1) << (pos % bits_per_word);
+    }
+
+    void mask_last_word()
+    {
+        const auto remainder = this->num_bits % bits_per_word;
+        if (remainder != 0)
+        {
+            this->words.back() &= (word_t(1) << remainder) - 1;
+        }
+    }
+
+    static size_t count_trailing_zeros(word_t word)
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+        unsigned long index = 0;
+        _BitScanForward64(&index, word);
+        return index;
+#elif defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_ctzll(word));
+#else
+        size_t count = 0;
+        while ((word & 1) == 0)
+        {
+            word >>= 1;
+            ++count;
+        }
+        return count;
+#endif
+    }
+};
+
+} // namespace opendnp3
+
+#endif
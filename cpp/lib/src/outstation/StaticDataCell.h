@@ -24,40 +24,21 @@ namespace opendnp3
 {
 
 /**
- * Type used to record whether a value is requested in a response
+ * Type used to record the value and variation of a point requested in a response
  */
 template<class Spec> struct SelectedValue
 {
     SelectedValue() = default;
 
-    SelectedValue(bool selected, const typename Spec::meas_t& value, typename Spec::static_variation_t variation)
-        : selected(selected), value(value), variation(variation)
+    SelectedValue(const typename Spec::meas_t& value, typename Spec::static_variation_t variation)
+        : value(value), variation(variation)
     {
     }
 
-    bool selected = false;
     typename Spec::meas_t value;
     typename Spec::static_variation_t variation = Spec::DefaultStaticVariation;
 };
 
-/**
- * Holds particular measurement type in the database.
- */
-template<class Spec> struct StaticDataCell
-{
-    typename Spec::meas_t value;       // current value
-    typename Spec::config_t config;    // configuration
-    typename Spec::event_cell_t event; // event cell
-    SelectedValue<Spec> selection;     // selected value
-
-    StaticDataCell() = default;
-    StaticDataCell(const typename Spec::meas_t& value, const typename Spec::config_t& config)
-        : value(value), config(config)
-    {
-    }
-    StaticDataCell(const typename Spec::config_t& config) : value(config.defaultValue), config(config) {}
-};
-
 } // namespace opendnp3
 
 #endif
@@ -47,13 +47,14 @@ bool StaticDataMap<TimeAndIntervalSpec>::update(const TimeAndInterval& value,
                                                 EventMode /*mode*/,
                                                 IEventReceiver& /*receiver*/)
 {
-    const auto iter = this->map.find(index);
-    if (iter == this->map.end())
+    const auto slot = this->find(index);
+    if (slot == this->indices.size())
     {
         return false;
     }
 
-    iter->second.value = value;
+    this->preserve(slot);
+    this->values.set(slot, value);
 
     return true;
 }
@@ -20,16 +20,26 @@
 #ifndef OPENDNP3_STATICDATAMAP_H
 #define OPENDNP3_STATICDATAMAP_H
 
+#include "app/DeadbandKernel.h"
 #include "app/MeasurementTypeSpecs.h"
 #include "app/Range.h"
 #include "outstation/IEventReceiver.h"
+#include "outstation/SlotBitset.h"
 #include "outstation/StaticDataCell.h"
+#include "outstation/ValueArray.h"
 
 #include "opendnp3/gen/EventMode.h"
+#include "opendnp3/outstation/UpdateBatch.h"
 #include "opendnp3/util/Uncopyable.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
+#include <limits>
 #include <map>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 namespace opendnp3
 {
@@ -45,10 +55,34 @@ typename Spec::static_variation_t check_for_promotion(const typename Spec::meas_
 
 template<> StaticBinaryVariation check_for_promotion<BinarySpec>(const Binary& value, StaticBinaryVariation variation);
 
+/**
+ * Holds the static values of a particular measurement type.
+ *
+ * Points are stored as a structure of arrays sorted by index: the current values, configurations and
+ * the values that last produced an event each live in their own parallel array. The selection state is
+ * a bitset over the slots plus a table holding the variation of each selected slot. Octet strings are
+ * kept in an arena so that they only cost their actual length (see ValueArray).
+ *
+ * Selecting a point does not copy its value. Responses read the live value unless the point changed
+ * after it was selected, in which case the value at selection time is preserved on the first change.
+ * Only the points that change while a (possibly multi-fragment) response is pending cost a copy.
+ *
+ * When coalescing is enabled, EventMode::Suppress and EventMode::Detect updates to a Class 0 point only store the
+ * new value. The event detection bookkeeping for the point is deferred until it is touched by an update that can
+ * produce an event, or until it is assigned to an event class. Updates to event class points, including suppressed
+ * ones, always keep the last event values current so that their deadbands behave exactly as w/o coalescing.
+ *
+ * Batches of updates to the deadband types (analogs and counters) are compared against the last event values a
+ * block at a time using the DeadbandKernel, and only the points that it flags go through the full event path.
+ *
+ * When the configured indices are dense enough, a directory maps every index in the configured span
+ * to its lower bound slot so that lookups are O(1). Sparse configurations fall back to a binary search
+ * over the sorted indices.
+ */
 template<class Spec> class StaticDataMap : private Uncopyable
 {
-    using map_t = std::map<uint16_t, StaticDataCell<Spec>>;
-    using map_iter_t = typename map_t::iterator;
+    // the directory is only built if it requires no more than this many entries per point
+    static constexpr size_t max_directory_entries_per_point = 4;
 
 public:
     StaticDataMap() = default;
@@ -56,56 +90,51 @@ public:
 
     class iterator
     {
-        map_iter_t iter;
-        map_iter_t end;
+        StaticDataMap* map;
+        size_t slot;
         Range& range;
 
     public:
-        explicit iterator(map_iter_t begin, map_iter_t end, Range& range) : iter(begin), end(end), range(range) {}
+        explicit iterator(StaticDataMap& map, size_t slot, Range& range) : map(&map), slot(slot), range(range) {}
 
         using value_type = std::pair<uint16_t, SelectedValue<Spec>>;
-        using difference_type = typename map_iter_t::difference_type;
-        using pointer = typename map_iter_t::pointer;
-        using reference = std::pair<uint16_t, SelectedValue<Spec>&>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type*;
+        using reference = value_type;
         using iterator_category = std::input_iterator_tag;
 
         bool operator==(const iterator& rhs)
         {
-            return this->iter == rhs.iter;
+            return this->slot == rhs.slot;
         }
         bool operator!=(const iterator& rhs)
         {
-            return this->iter != rhs.iter;
+            return this->slot != rhs.slot;
         }
 
         void operator++()
         {
             // unselect the point
-            this->iter->second.selection.selected = false;
-
-            while (true)
-            {
-                iter++;
+            this->map->release(this->slot);
+            this->map->selected_slots.reset(this->slot);
 
-                if (iter == this->end)
-                {
-                    this->range = Range::Invalid();
-                    return;
-                }
+            this->slot = this->map->selected_slots.find_next(this->slot + 1);
 
-                // shorten the range
-                this->range.start = iter->first;
-
-                if (iter->second.selection.selected)
-                {
-                    return;
-                }
+            if (this->slot == this->map->selected_slots.size())
+            {
+                this->range = Range::Invalid();
+                return;
             }
+
+            // shorten the range
+            this->range.start = this->map->indices[this->slot];
         }
 
         reference operator*()
         {
-            return reference(iter->first, iter->second.selection);
+            return reference(this->map->indices[this->slot],
+                             SelectedValue<Spec>{this->map->get_selected_value(this->slot),
+                                                 this->map->variations[this->slot]});
         }
     };
 
@@ -113,8 +142,16 @@ public:
 
     bool update(const typename Spec::meas_t& value, uint16_t index, EventMode mode, IEventReceiver& receiver);
 
+    // apply a contiguous run of updates in order
+    void update(const UpdateBatch::Record<typename Spec::meas_t>* records, size_t count, IEventReceiver& receiver);
+
     bool modify(uint16_t start, uint16_t stop, uint8_t flags, IEventReceiver& receiver);
 
+    void set_coalescing(bool enabled)
+    {
+        this->coalesce = enabled;
+    }
+
     void clear_selection();
 
     bool has_any_selection() const
@@ -166,15 +203,56 @@ public:
     iterator end();
 
 private:
-    map_t map;
+    std::vector<uint16_t> indices;                             // sorted point indices
+    ValueArray<typename Spec::meas_t> values;                  // current values
+    std::vector<typename Spec::config_t> configs;              // configurations
+    ValueArray<typename Spec::meas_t> last_events;             // values that last produced an event
+    std::vector<typename Spec::static_variation_t> variations; // variation of each selected slot
+    SlotBitset selected_slots;                                 // slots that are selected
+    SlotBitset preserved_slots;                                // selected slots that changed after selection
+    SlotBitset deferred_slots;                                 // slots with deferred event detection
+    bool coalesce = false;
+
+    // value at selection time of the points in preserved_slots, keyed by point index
+    std::unordered_map<uint16_t, typename Spec::meas_t> preserved;
+
+    // (index - first index) -> lower bound slot, empty when sparse
+    std::vector<uint32_t> directory;
+
     Range selected;
 
     Range get_full_range() const;
 
-    bool update(const map_iter_t& iter,
-                const typename Spec::meas_t& new_value,
-                EventMode mode,
-                IEventReceiver& receiver);
+    // @return the first slot whose index is >= the specified index, or the number of slots
+    size_t lower_bound(uint16_t index) const;
+
+    // @return the first slot whose index is > the specified index, or the number of slots
+    size_t upper_bound(uint16_t index) const;
+
+    // @return the slot for the specified index, or the number of slots if not present
+    size_t find(uint16_t index) const;
+
+    void build_directory();
+
+    // apply a run of updates one at a time
+    void update_records(const UpdateBatch::Record<typename Spec::meas_t>* records,
+                        size_t count,
+                        IEventReceiver& receiver,
+                        std::false_type);
+
+    // apply a run of updates, using the DeadbandKernel for blocks of EventMode::Detect updates to ascending slots
+    void update_records(const UpdateBatch::Record<typename Spec::meas_t>* records,
+                        size_t count,
+                        IEventReceiver& receiver,
+                        std::true_type);
+
+    bool update(size_t slot, const typename Spec::meas_t& new_value, EventMode mode, IEventReceiver& receiver);
+
+    // perform the event detection bookkeeping that was deferred for a coalesced slot
+    void flush_deferred(size_t slot);
+
+    // change the class of a slot, performing any deferred bookkeeping before it can produce events again
+    void set_class(size_t slot, PointClass clazz);
 
     // generic implementation of select_all that accepts a function
     // that can use or override the default variation
@@ -183,25 +261,62 @@ private:
     // generic implementation of select that accepts a function
     // that can use or override the default variation
     template<class F> size_t select(Range range, F get_variation);
+
+    // record the variation of every slot in [begin, end)
+    template<class F> void capture_selection(size_t begin, size_t end, F get_variation);
+
+    // copy the current value of a selected slot before it is modified for the first time
+    void preserve(size_t slot);
+
+    // discard any value preserved for a slot
+    void release(size_t slot);
+
+    typename Spec::meas_t get_selected_value(size_t slot) const;
 };
 
 template<class Spec> StaticDataMap<Spec>::StaticDataMap(const std::map<uint16_t, typename Spec::config_t>& config)
 {
+    this->indices.reserve(config.size());
+    this->values.reserve(config.size());
+    this->configs.reserve(config.size());
+
+    // the configuration is already sorted by index
     for (const auto& item : config)
     {
-        this->map[item.first] = StaticDataCell<Spec>{item.second};
+        this->indices.push_back(item.first);
+        this->values.push_back(item.second.defaultValue);
+        this->configs.push_back(item.second);
     }
+
+    this->last_events.resize(config.size());
+    this->variations.resize(config.size(), Spec::DefaultStaticVariation);
+    this->selected_slots.resize(config.size());
+    this->preserved_slots.resize(config.size());
+    this->deferred_slots.resize(config.size());
+
+    this->build_directory();
 }
 
 template<class Spec>
 bool StaticDataMap<Spec>::add(const typename Spec::meas_t& value, uint16_t index, typename Spec::config_t config)
 {
-    if (this->map.find(index) != this->map.end())
+    const auto slot = this->lower_bound(index);
+
+    if (slot < this->indices.size() && this->indices[slot] == index)
     {
         return false;
     }
 
-    this->map[index] = StaticDataCell<Spec>{value, config};
+    this->indices.insert(this->indices.begin() + slot, index);
+    this->values.insert(slot, value);
+    this->configs.insert(this->configs.begin() + slot, config);
+    this->last_events.insert(slot, typename Spec::meas_t());
+    this->variations.insert(this->variations.begin() + slot, Spec::DefaultStaticVariation);
+    this->selected_slots.insert(slot);
+    this->preserved_slots.insert(slot);
+    this->deferred_slots.insert(slot);
+
+    this->build_directory();
 
     return true;
 }
@@ -218,47 +333,223 @@ bool StaticDataMap<Spec>::update(const typename Spec::meas_t& value,
                                  EventMode mode,
                                  IEventReceiver& receiver)
 {
-    return update(this->map.find(index), value, mode, receiver);
+    return update(this->find(index), value, mode, receiver);
 }
 
-template<class Spec> void StaticDataMap<Spec>::clear_selection()
+template<class Spec>
+void StaticDataMap<Spec>::update(const UpdateBatch::Record<typename Spec::meas_t>* records,
+                                 size_t count,
+                                 IEventReceiver& receiver)
+{
+    this->update_records(records, count, receiver, DeadbandKernelTraits<Spec>());
+}
+
+template<class Spec>
+void StaticDataMap<Spec>::update_records(const UpdateBatch::Record<typename Spec::meas_t>* records,
+                                         size_t count,
+                                         IEventReceiver& receiver,
+                                         std::false_type)
 {
-    // the act of iterating clears the selection
-    for (auto iter = this->begin(); iter != this->end(); ++iter)
+    for (size_t i = 0; i < count; ++i)
     {
+        this->update(records[i].meas, records[i].index, records[i].mode, receiver);
     }
 }
 
+template<class Spec>
+void StaticDataMap<Spec>::update_records(const UpdateBatch::Record<typename Spec::meas_t>* records,
+                                         size_t count,
+                                         IEventReceiver& receiver,
+                                         std::true_type)
+{
+    using value_t = typename DeadbandKernelTraits<Spec>::value_t;
+
+    DeadbandBlock<value_t> block;
+    size_t slots[DeadbandBlock<value_t>::max_size];
+
+    size_t pos = 0;
+    while (pos < count)
+    {
+        // gather a block of Detect updates to strictly ascending slots. Each slot appears at most once,
+        // so the last event value of every lane is unaffected by the other lanes of the block.
+        size_t num_lanes = 0;
+        while (pos + num_lanes < count && num_lanes < DeadbandBlock<value_t>::max_size)
+        {
+            const auto& record = records[pos + num_lanes];
+            if (record.mode != EventMode::Detect)
+            {
+                break;
+            }
+
+            // contiguous indices are the common case, so try the slot that follows the previous one first
+            const auto next = (num_lanes == 0) ? this->indices.size() : slots[num_lanes - 1] + 1;
+            const bool is_next = (next < this->indices.size()) && (this->indices[next] == record.index);
+            const auto slot = is_next ? next : this->find(record.index);
+
+            if (slot == this->indices.size() || (num_lanes > 0 && slot <= slots[num_lanes - 1]))
+            {
+                break;
+            }
+
+            const auto& last_event = this->last_events.get(slot);
+            block.old_values[num_lanes] = last_event.value;
+            block.old_flags[num_lanes] = last_event.flags.value;
+            block.new_values[num_lanes] = record.meas.value;
+            block.new_flags[num_lanes] = record.meas.flags.value;
+            block.deadbands[num_lanes] = this->configs[slot].deadband;
+            slots[num_lanes] = slot;
+            ++num_lanes;
+        }
+
+        if (num_lanes == 0)
+        {
+            this->update(records[pos].meas, records[pos].index, records[pos].mode, receiver);
+            ++pos;
+            continue;
+        }
+
+        const auto events = DeadbandKernel::detect_events(block, num_lanes);
+
+        for (size_t lane = 0; lane < num_lanes; ++lane)
+        {
+            const auto slot = slots[lane];
+            const auto& value = records[pos + lane].meas;
+
+            const bool deferred = this->deferred_slots.test(slot)
+                || (this->coalesce && this->configs[slot].clazz == PointClass::Class0);
+
+            if ((events & (uint64_t(1) << lane)) || deferred)
+            {
+                this->update(slot, value, EventMode::Detect, receiver);
+            }
+            else
+            {
+                // not an event, so the scalar path would only store the value
+                this->preserve(slot);
+                this->values.set(slot, value);
+            }
+        }
+
+        pos += num_lanes;
+    }
+}
+
+template<class Spec> void StaticDataMap<Spec>::clear_selection()
+{
+    this->selected_slots.reset_all();
+    this->preserved_slots.reset_all();
+    this->preserved.clear();
+    this->selected = Range::Invalid();
+}
+
 template<class Spec> Range StaticDataMap<Spec>::get_full_range() const
 {
-    return this->map.empty() ? Range::Invalid() : Range::From(this->map.begin()->first, this->map.rbegin()->first);
+    return this->indices.empty() ? Range::Invalid() : Range::From(this->indices.front(), this->indices.back());
+}
+
+template<class Spec> size_t StaticDataMap<Spec>::lower_bound(uint16_t index) const
+{
+    if (this->directory.empty())
+    {
+        return std::lower_bound(this->indices.begin(), this->indices.end(), index) - this->indices.begin();
+    }
+
+    if (index < this->indices.front())
+    {
+        return 0;
+    }
+
+    const size_t offset = index - this->indices.front();
+    return (offset < this->directory.size()) ? this->directory[offset] : this->indices.size();
+}
+
+template<class Spec> size_t StaticDataMap<Spec>::upper_bound(uint16_t index) const
+{
+    return (index == std::numeric_limits<uint16_t>::max()) ? this->indices.size() : this->lower_bound(index + 1);
+}
+
+template<class Spec> size_t StaticDataMap<Spec>::find(uint16_t index) const
+{
+    const auto slot = this->lower_bound(index);
+    return (slot < this->indices.size() && this->indices[slot] == index) ? slot : this->indices.size();
+}
+
+template<class Spec> void StaticDataMap<Spec>::build_directory()
+{
+    this->directory.clear();
+
+    if (this->indices.empty())
+    {
+        return;
+    }
+
+    const size_t span = static_cast<size_t>(this->indices.back()) - this->indices.front() + 1;
+
+    if (span > max_directory_entries_per_point * this->indices.size())
+    {
+        // too sparse, use binary search instead
+        this->directory.shrink_to_fit();
+        return;
+    }
+
+    this->directory.resize(span);
+
+    uint32_t slot = 0;
+    for (size_t offset = 0; offset < span; ++offset)
+    {
+        while (this->indices[slot] < this->indices.front() + offset)
+        {
+            ++slot;
+        }
+
+        this->directory[offset] = slot;
+    }
 }
 
 template<class Spec>
-bool StaticDataMap<Spec>::update(const map_iter_t& iter,
+bool StaticDataMap<Spec>::update(size_t slot,
                                  const typename Spec::meas_t& new_value,
                                  EventMode mode,
                                  IEventReceiver& receiver)
 {
-    if (iter == this->map.end())
+    if (slot >= this->indices.size())
     {
         return false;
     }
 
+    const auto& config = this->configs[slot];
+
+    if (this->coalesce && config.clazz == PointClass::Class0
+        && (mode == EventMode::Suppress || mode == EventMode::Detect))
+    {
+        // this update can't produce an event, so only retain the value
+        this->preserve(slot);
+        this->values.set(slot, new_value);
+        this->deferred_slots.set(slot);
+        return true;
+    }
+
+    if (this->deferred_slots.test(slot))
+    {
+        this->flush_deferred(slot);
+    }
+
     if (mode != EventMode::EventOnly)
     {
-        iter->second.value = new_value;
+        this->preserve(slot);
+        this->values.set(slot, new_value);
     }
 
-    if (mode == EventMode::Force || mode == EventMode::EventOnly || Spec::IsEvent(iter->second.event.lastEvent, new_value, iter->second.config))
+    if (mode == EventMode::Force || mode == EventMode::EventOnly
+        || Spec::IsEvent(this->last_events.get(slot), new_value, config))
     {
-        iter->second.event.lastEvent = new_value;
+        this->last_events.set(slot, new_value);
         if (mode != EventMode::Suppress)
         {
             EventClass ec;
-            if (convert_to_event_class(iter->second.config.clazz, ec))
+            if (convert_to_event_class(config.clazz, ec))
             {
-                receiver.Update(Event<Spec>(new_value, iter->first, ec, iter->second.config.evariation));
+                receiver.Update(Event<Spec>(new_value, this->indices[slot], ec, config.evariation));
             }
         }
     }
@@ -266,6 +557,27 @@ bool StaticDataMap<Spec>::update(const map_iter_t& iter,
     return true;
 }
 
+template<class Spec> void StaticDataMap<Spec>::flush_deferred(size_t slot)
+{
+    this->deferred_slots.reset(slot);
+
+    const auto& value = this->values.get(slot);
+    if (Spec::IsEvent(this->last_events.get(slot), value, this->configs[slot]))
+    {
+        this->last_events.set(slot, value);
+    }
+}
+
+template<class Spec> void StaticDataMap<Spec>::set_class(size_t slot, PointClass clazz)
+{
+    if (this->deferred_slots.test(slot))
+    {
+        this->flush_deferred(slot);
+    }
+
+    this->configs[slot].clazz = clazz;
+}
+
 template<class Spec>
 bool StaticDataMap<Spec>::modify(uint16_t start, uint16_t stop, uint8_t flags, IEventReceiver& receiver)
 {
@@ -274,16 +586,16 @@ bool StaticDataMap<Spec>::modify(uint16_t start, uint16_t stop, uint8_t flags, I
         return false;
     }
 
-    for (auto iter = this->map.lower_bound(start); iter != this->map.end(); ++iter)
+    for (auto slot = this->lower_bound(start); slot < this->indices.size(); ++slot)
     {
-        if (iter->first > stop)
+        if (this->indices[slot] > stop)
         {
             return false;
         }
 
-        auto new_value = iter->second.value;
+        auto new_value = this->values.get(slot);
         new_value.flags = Flags(flags);
-        this->update(iter, new_value, EventMode::Detect, receiver);
+        this->update(slot, new_value, EventMode::Detect, receiver);
     }
 
     return true;
@@ -291,22 +603,17 @@ bool StaticDataMap<Spec>::modify(uint16_t start, uint16_t stop, uint8_t flags, I
 
 template<class Spec> template<class F> size_t StaticDataMap<Spec>::select_all(F get_variation)
 {
-    if (map.empty())
+    if (this->indices.empty())
     {
         return 0;
     }
     else
     {
-        this->selected = Range::From(map.begin()->first, map.rbegin()->first);
-
-        for (auto& iter : this->map)
-        {
-            iter.second.selection = SelectedValue<Spec>{
-                true, iter.second.value,
-                check_for_promotion<Spec>(iter.second.value, get_variation(iter.second.config.svariation))};
-        }
+        this->selected = this->get_full_range();
+        this->selected_slots.set_all();
+        this->capture_selection(0, this->indices.size(), get_variation);
 
-        return this->map.size();
+        return this->indices.size();
     }
 }
 
@@ -317,45 +624,83 @@ template<class Spec> template<class F> size_t StaticDataMap<Spec>::select(Range
         return 0;
     }
 
-    const auto start = this->map.lower_bound(range.start);
+    const auto start = this->lower_bound(range.start);
 
-    if (start == this->map.end())
+    if (start == this->indices.size())
     {
         return 0;
     }
 
-    if (!range.Contains(start->first))
+    if (!range.Contains(this->indices[start]))
     {
         return 0;
     }
 
-    uint16_t stop = 0;
-    size_t count = 0;
+    // the selected slots are contiguous
+    const auto end = this->upper_bound(range.stop);
+
+    this->selected_slots.set_range(start, end);
+    this->capture_selection(start, end, get_variation);
+
+    this->selected = this->selected.Union(Range::From(this->indices[start], this->indices[end - 1]));
+
+    return end - start;
+}
 
-    for (auto iter = start; iter != this->map.end(); ++iter)
+template<class Spec> void StaticDataMap<Spec>::preserve(size_t slot)
+{
+    if (this->selected_slots.test(slot) && !this->preserved_slots.test(slot))
     {
-        if (!range.Contains(iter->first))
-        {
-            break;
-        }
+        this->preserved_slots.set(slot);
+        this->preserved.emplace(this->indices[slot], this->values.get(slot));
+    }
+}
 
-        stop = iter->first;
-        iter->second.selection = SelectedValue<Spec>{
-            true, iter->second.value,
-            check_for_promotion<Spec>(iter->second.value, get_variation(iter->second.config.svariation))};
-        ++count;
+template<class Spec> void StaticDataMap<Spec>::release(size_t slot)
+{
+    if (this->preserved_slots.test(slot))
+    {
+        this->preserved_slots.reset(slot);
+        this->preserved.erase(this->indices[slot]);
     }
+}
 
-    this->selected = this->selected.Union(Range::From(start->first, stop));
+template<class Spec> typename Spec::meas_t StaticDataMap<Spec>::get_selected_value(size_t slot) const
+{
+    if (this->preserved_slots.test(slot))
+    {
+        return this->preserved.find(this->indices[slot])->second;
+    }
 
-    return count;
+    return this->values.get(slot);
+}
+
+template<class Spec>
+template<class F>
+void StaticDataMap<Spec>::capture_selection(size_t begin, size_t end, F get_variation)
+{
+    for (auto slot = begin; slot < end; ++slot)
+    {
+        const auto variation = get_variation(this->configs[slot].svariation);
+        this->variations[slot] = check_for_promotion<Spec>(this->values.get(slot), variation);
+    }
+
+    // re-selecting a point reads its current value
+    if (!this->preserved.empty())
+    {
+        for (auto slot = this->preserved_slots.find_next(begin); slot < end;
+             slot = this->preserved_slots.find_next(slot + 1))
+        {
+            this->release(slot);
+        }
+    }
 }
 
 template<class Spec> Range StaticDataMap<Spec>::assign_class(PointClass clazz)
 {
-    for (auto& elem : this->map)
+    for (size_t slot = 0; slot < this->configs.size(); ++slot)
     {
-        elem.second.config.clazz = clazz;
+        this->set_class(slot, clazz);
     }
 
     return this->get_full_range();
@@ -363,9 +708,10 @@ template<class Spec> Range StaticDataMap<Spec>::assign_class(PointClass clazz)
 
 template<class Spec> Range StaticDataMap<Spec>::assign_class(PointClass clazz, const Range& range)
 {
-    for (auto iter = this->map.lower_bound(range.start); iter != this->map.end() && range.Contains(iter->first); iter++)
+    for (auto slot = this->lower_bound(range.start); slot < this->indices.size() && range.Contains(this->indices[slot]);
+         ++slot)
     {
-        iter->second.config.clazz = clazz;
+        this->set_class(slot, clazz);
     }
 
     return range.Intersection(this->get_full_range());
@@ -375,17 +721,16 @@ template<class Spec> typename StaticDataMap<Spec>::iterator StaticDataMap<Spec>:
 {
     if (!this->selected.IsValid())
     {
-        return iterator(this->map.end(), this->map.end(), this->selected);
+        return this->end();
     }
 
-    const auto begin = this->map.lower_bound(this->selected.start);
-
-    return iterator(begin, this->map.end(), this->selected);
+    const auto first = this->selected_slots.find_next(this->lower_bound(this->selected.start));
+    return iterator(*this, first, this->selected);
 }
 
 template<class Spec> typename StaticDataMap<Spec>::iterator StaticDataMap<Spec>::end()
 {
-    return iterator(this->map.end(), this->map.end(), this->selected);
+    return iterator(*this, this->indices.size(), this->selected);
 }
 
 } // namespace opendnp3
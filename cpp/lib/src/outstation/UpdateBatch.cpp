@@ -0,0 +1,136 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "opendnp3/outstation/UpdateBatch.h"
+
+namespace opendnp3
+{
+
+template<class T> using record_t = UpdateBatch::Record<T>;
+
+bool UpdateBatch::Update(const Binary& meas, uint16_t index, EventMode mode)
+{
+    return this->Add<Column::binary>(record_t<Binary>{meas, index, mode});
+}
+
+bool UpdateBatch::Update(const DoubleBitBinary& meas, uint16_t index, EventMode mode)
+{
+    return this->Add<Column::double_binary>(record_t<DoubleBitBinary>{meas, index, mode});
+}
+
+bool UpdateBatch::Update(const Analog& meas, uint16_t index, EventMode mode)
+{
+    return this->Add<Column::analog>(record_t<Analog>{meas, index, mode});
+}
+
+bool UpdateBatch::Update(const Counter& meas, uint16_t index, EventMode mode)
+{
+    return this->Add<Column::counter>(record_t<Counter>{meas, index, mode});
+}
+
+bool UpdateBatch::FreezeCounter(uint16_t index, bool clear, EventMode mode)
+{
+    return this->Add<Column::freeze>(FreezeRecord{index, clear, mode});
+}
+
+bool UpdateBatch::Update(const BinaryOutputStatus& meas, uint16_t index, EventMode mode)
+{
+    return this->Add<Column::binary_output_status>(record_t<BinaryOutputStatus>{meas, index, mode});
+}
+
+bool UpdateBatch::Update(const AnalogOutputStatus& meas, uint16_t index, EventMode mode)
+{
+    return this->Add<Column::analog_output_status>(record_t<AnalogOutputStatus>{meas, index, mode});
+}
+
+bool UpdateBatch::Update(const OctetString& meas, uint16_t index, EventMode mode)
+{
+    return this->Add<Column::octet_string>(record_t<OctetString>{meas, index, mode});
+}
+
+bool UpdateBatch::Update(const TimeAndInterval& meas, uint16_t index)
+{
+    return this->Add<Column::time_and_interval>(record_t<TimeAndInterval>{meas, index, EventMode::Suppress});
+}
+
+bool UpdateBatch::Modify(FlagsType type, uint16_t start, uint16_t stop, uint8_t flags)
+{
+    return this->Add<Column::modify>(ModifyRecord{type, start, stop, flags});
+}
+
+void UpdateBatch::Clear()
+{
+    std::get<0>(this->columns).clear();
+    std::get<1>(this->columns).clear();
+    std::get<2>(this->columns).clear();
+    std::get<3>(this->columns).clear();
+    std::get<4>(this->columns).clear();
+    std::get<5>(this->columns).clear();
+    std::get<6>(this->columns).clear();
+    std::get<7>(this->columns).clear();
+    std::get<8>(this->columns).clear();
+    std::get<9>(this->columns).clear();
+    this->runs.clear();
+}
+
+size_t UpdateBatch::Size() const
+{
+    size_t count = 0;
+    for (const auto& run : this->runs)
+    {
+        count += run.count;
+    }
+    return count;
+}
+
+namespace
+{
+    template<class T> void apply_record(IUpdateHandler& handler, const record_t<T>& record)
+    {
+        handler.Update(record.meas, record.index, record.mode);
+    }
+
+    void apply_record(IUpdateHandler& handler, const record_t<TimeAndInterval>& record)
+    {
+        handler.Update(record.meas, record.index);
+    }
+
+    void apply_record(IUpdateHandler& handler, const UpdateBatch::FreezeRecord& record)
+    {
+        handler.FreezeCounter(record.index, record.clear, record.mode);
+    }
+
+    void apply_record(IUpdateHandler& handler, const UpdateBatch::ModifyRecord& record)
+    {
+        handler.Modify(record.type, record.start, record.stop, record.flags);
+    }
+} // namespace
+
+void UpdateBatch::Apply(IUpdateHandler& handler) const
+{
+    this->ForEachRun([&handler](const auto* records, size_t count) {
+        for (size_t i = 0; i < count; ++i)
+        {
+            apply_record(handler, records[i]);
+        }
+    });
+}
+
+} // namespace opendnp3
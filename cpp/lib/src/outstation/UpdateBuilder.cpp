@@ -25,75 +25,67 @@ namespace opendnp3
 
 Updates UpdateBuilder::Build()
 {
-    return Updates(std::move(this->updates));
+    return Updates(std::shared_ptr<const UpdateBatch>(std::move(this->batch)));
 }
 
 bool UpdateBuilder::Update(const Binary& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    return this->GetBatch().Update(meas, index, mode);
 }
 
 bool UpdateBuilder::Update(const DoubleBitBinary& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    return this->GetBatch().Update(meas, index, mode);
 }
 
 bool UpdateBuilder::Update(const Analog& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    return this->GetBatch().Update(meas, index, mode);
 }
 
 bool UpdateBuilder::Update(const Counter& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    return this->GetBatch().Update(meas, index, mode);
 }
 
 bool UpdateBuilder::FreezeCounter(uint16_t index, bool clear, EventMode mode)
 {
-    this->Add([=](IUpdateHandler& handler) { handler.FreezeCounter(index, clear, mode); });
-    return true;
+    return this->GetBatch().FreezeCounter(index, clear, mode);
 }
 
 bool UpdateBuilder::Update(const BinaryOutputStatus& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    return this->GetBatch().Update(meas, index, mode);
 }
 
 bool UpdateBuilder::Update(const AnalogOutputStatus& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    return this->GetBatch().Update(meas, index, mode);
 }
 
 bool UpdateBuilder::Update(const OctetString& meas, uint16_t index, EventMode mode)
 {
-    return this->AddMeas(meas, index, mode);
+    return this->GetBatch().Update(meas, index, mode);
 }
 
 bool UpdateBuilder::Update(const TimeAndInterval& meas, uint16_t index)
 {
-    return this->Add([=](IUpdateHandler& handler) { handler.Update(meas, index); });
+    return this->GetBatch().Update(meas, index);
 }
 
 bool UpdateBuilder::Modify(FlagsType type, uint16_t start, uint16_t stop, uint8_t flags)
 {
-    return this->Add([=](IUpdateHandler& handler) { handler.Modify(type, start, stop, flags); });
+    return this->GetBatch().Modify(type, start, stop, flags);
 }
 
-template<class T> bool UpdateBuilder::AddMeas(const T& meas, uint16_t index, EventMode mode)
+UpdateBatch& UpdateBuilder::GetBatch()
 {
-    return this->Add([=](IUpdateHandler& handler) { handler.Update(meas, index, mode); });
-}
-
-bool UpdateBuilder::Add(const update_func_t& fun)
-{
-    if (!this->updates)
+    if (!this->batch)
     {
-        this->updates = std::make_shared<shared_updates_t>();
+        this->batch = std::make_shared<UpdateBatch>();
     }
 
-    updates->push_back(fun);
-
-    return true;
+    return *this->batch;
 }
 
 } // namespace opendnp3
@@ -0,0 +1,222 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_UPDATEQUEUE_H
+#define OPENDNP3_UPDATEQUEUE_H
+
+#include "opendnp3/outstation/Updates.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * Bounded lock-free multi-producer / single-consumer queue of Updates
+ *
+ * Any number of threads may push concurrently. Only the outstation's strand may drain the queue.
+ * A doorbell flag ensures that at most one drain is scheduled at a time no matter how many
+ * producers push before it runs.
+ *
+ * Updates that don't fit in the ring are kept in a locked overflow list. While the list isn't empty every push goes
+ * behind it, so the updates of a single producer are always consumed in the order they were pushed.
+ */
+class UpdateQueue : private Uncopyable
+{
+public:
+    explicit UpdateQueue(size_t capacity) : mask(round_up_to_power_of_two(capacity) - 1), cells(mask + 1)
+    {
+        for (size_t i = 0; i < this->cells.size(); ++i)
+        {
+            this->cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~UpdateQueue()
+    {
+        this->Drain([](const Updates&) {});
+    }
+
+    size_t Capacity() const
+    {
+        return this->cells.size();
+    }
+
+    /**
+     * Push a set of updates from any thread
+     * @return false if the ring is full or updates are waiting in the overflow list
+     */
+    bool TryPush(const Updates& updates)
+    {
+        return (this->num_overflow.load(std::memory_order_acquire) == 0) && this->PushToRing(updates);
+    }
+
+    /**
+     * Push a set of updates from any thread, adding them to the overflow list if they can't go in the ring
+     */
+    void Push(const Updates& updates)
+    {
+        if (this->TryPush(updates))
+            return;
+
+        std::lock_guard<std::mutex> lock(this->overflow_mutex);
+        this->overflow.push_back(updates);
+        this->num_overflow.store(this->overflow.size(), std::memory_order_release);
+    }
+
+    /**
+     * Ring the doorbell after a successful push
+     * @return true if the caller is responsible for scheduling a drain
+     */
+    bool RequestDrain()
+    {
+        return !this->drain_requested.exchange(true, std::memory_order_acq_rel);
+    }
+
+    /**
+     * Consume every published entry. Must only be called from the consumer, and consume must not push.
+     * @return the number of entries consumed
+     */
+    template<class F> size_t Drain(F consume)
+    {
+        // clear the doorbell first so that any push that we miss schedules another drain
+        this->drain_requested.exchange(false, std::memory_order_acq_rel);
+
+        auto count = this->DrainRing(consume);
+
+        if (this->num_overflow.load(std::memory_order_acquire) == 0)
+        {
+            return count;
+        }
+
+        std::deque<Updates> overflowed;
+
+        {
+            // producers can't go around the overflow list while the lock is held, so everything they put in the
+            // ring before their first overflowed push is consumed ahead of the list
+            std::lock_guard<std::mutex> lock(this->overflow_mutex);
+            count += this->DrainRing(consume);
+            overflowed.swap(this->overflow);
+            this->num_overflow.store(0, std::memory_order_release);
+        }
+
+        for (const auto& updates : overflowed)
+        {
+            consume(updates);
+        }
+
+        return count + overflowed.size();
+    }
+
+private:
+    bool PushToRing(const Updates& updates)
+    {
+        auto pos = this->enqueue_pos.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            auto& cell = this->cells[pos & this->mask];
+            const auto seq = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                if (this->enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    new (&cell.storage) Updates(updates);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                // the consumer hasn't released this cell yet
+                return false;
+            }
+            else
+            {
+                pos = this->enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    template<class F> size_t DrainRing(F& consume)
+    {
+        size_t count = 0;
+
+        while (true)
+        {
+            auto& cell = this->cells[this->dequeue_pos & this->mask];
+
+            if (cell.sequence.load(std::memory_order_acquire) != this->dequeue_pos + 1)
+            {
+                // empty, or the next producer hasn't finished publishing
+                return count;
+            }
+
+            auto& updates = *reinterpret_cast<Updates*>(&cell.storage);
+            consume(updates);
+            updates.~Updates();
+
+            cell.sequence.store(this->dequeue_pos + this->mask + 1, std::memory_order_release);
+            ++this->dequeue_pos;
+            ++count;
+        }
+    }
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        typename std::aligned_storage<sizeof(Updates), alignof(Updates)>::type storage;
+    };
+
+    // a ring of one cell can't tell a published entry from a released one, so the smallest ring has two
+    static size_t round_up_to_power_of_two(size_t value)
+    {
+        size_t result = 2;
+        while (result < value)
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const size_t mask;
+    std::vector<Cell> cells;
+
+    std::atomic<size_t> enqueue_pos{0};
+    std::atomic<bool> drain_requested{false};
+    size_t dequeue_pos = 0;
+
+    std::mutex overflow_mutex;
+    std::deque<Updates> overflow;
+    std::atomic<size_t> num_overflow{0};
+};
+
+} // namespace opendnp3
+
+#endif
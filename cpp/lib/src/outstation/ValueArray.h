@@ -0,0 +1,131 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_VALUEARRAY_H
+#define OPENDNP3_VALUEARRAY_H
+
+#include "outstation/OctetArena.h"
+
+#include "opendnp3/app/OctetString.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * An array of measurement values addressed by slot
+ */
+template<class T> class ValueArray
+{
+public:
+    size_t size() const
+    {
+        return this->items.size();
+    }
+
+    void reserve(size_t count)
+    {
+        this->items.reserve(count);
+    }
+
+    void resize(size_t count)
+    {
+        this->items.resize(count);
+    }
+
+    void push_back(const T& value)
+    {
+        this->items.push_back(value);
+    }
+
+    void insert(size_t slot, const T& value)
+    {
+        this->items.insert(this->items.begin() + slot, value);
+    }
+
+    const T& get(size_t slot) const
+    {
+        return this->items[slot];
+    }
+
+    void set(size_t slot, const T& value)
+    {
+        this->items[slot] = value;
+    }
+
+private:
+    std::vector<T> items;
+};
+
+/**
+ * Octet strings are held in an arena so that each one only costs roughly its actual length
+ */
+template<> class ValueArray<OctetString>
+{
+public:
+    size_t size() const
+    {
+        return this->handles.size();
+    }
+
+    void reserve(size_t count)
+    {
+        this->handles.reserve(count);
+    }
+
+    void resize(size_t count)
+    {
+        while (this->handles.size() < count)
+        {
+            this->push_back(OctetString());
+        }
+    }
+
+    void push_back(const OctetString& value)
+    {
+        this->handles.push_back(this->arena.Allocate(value.ToBuffer()));
+    }
+
+    void insert(size_t slot, const OctetString& value)
+    {
+        this->handles.insert(this->handles.begin() + slot, this->arena.Allocate(value.ToBuffer()));
+    }
+
+    OctetString get(size_t slot) const
+    {
+        OctetString value;
+        value.Set(this->arena.Get(this->handles[slot]));
+        return value;
+    }
+
+    void set(size_t slot, const OctetString& value)
+    {
+        this->handles[slot] = this->arena.Replace(this->handles[slot], value.ToBuffer());
+    }
+
+private:
+    std::vector<OctetArena::handle_t> handles;
+    OctetArena arena;
+};
+
+} // namespace opendnp3
+
+#endif
@@ -22,7 +22,6 @@
 
 #include "EventWriting.h"
 #include "IEventWriteHandler.h"
-#include "TypedStorage.h"
 
 namespace opendnp3
 {
@@ -30,15 +29,13 @@ namespace opendnp3
 template<class T> class EventCollection final : public IEventCollection<typename T::meas_t>
 {
 private:
-    List<EventRecord>::Iterator& iterator;
-    EventClassCounters& counters;
+    uint32_t& cursor;
+    EventRecords& records;
     typename T::event_variation_t variation;
 
 public:
-    EventCollection(List<EventRecord>::Iterator& iterator,
-                    EventClassCounters& counters,
-                    typename T::event_variation_t variation)
-        : iterator(iterator), counters(counters), variation(variation)
+    EventCollection(uint32_t& cursor, EventRecords& records, typename T::event_variation_t variation)
+        : cursor(cursor), records(records), variation(variation)
     {
     }
 
@@ -61,30 +58,27 @@ template<class T> uint16_t EventCollection<T>::WriteSome(IEventWriter<typename T
 template<class T> bool EventCollection<T>::WriteOne(IEventWriter<typename T::meas_t>& writer)
 {
     // don't bother searching
-    if (this->counters.selected == 0)
+    if (this->records.counters.selected == 0)
         return false;
 
     // find the next event with the same type and variation
-    EventRecord* record = EventWriting::FindNextSelected(this->iterator, T::EventTypeEnum);
+    if (!EventWriting::FindNextSelected(this->cursor, this->records, T::EventTypeEnum))
+        return false; // nothing left to write
 
-    // nothing left to write
-    if (!record)
-        return false;
-
-    const auto data = TypedStorage<T>::Retrieve(*record);
+    const auto position = this->records.SelectedPosition(this->cursor);
+    const auto& data = this->records.template GetPool<T>()[this->records.Slot(position)];
 
     // wrong variation
-    if (data->value.selectedVariation != this->variation)
+    if (data.selectedVariation != this->variation)
         return false;
 
     // unable to write
-    if (!writer.Write(data->value.value, record->index))
+    if (!writer.Write(this->records.GetValue(data), this->records.Index(position)))
         return false;
 
     // success!
-    this->counters.OnWrite(record->clazz);
-    record->state = EventState::written;
-    this->iterator.Next();
+    this->records.MarkWritten(position);
+    ++this->cursor;
     return true;
 }
 
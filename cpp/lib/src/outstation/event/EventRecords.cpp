@@ -0,0 +1,241 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EventRecords.h"
+
+#include <algorithm>
+
+namespace opendnp3
+{
+
+EventRecords::EventRecords(const EventBufferConfig& config)
+    : indices(2 * config.TotalEvents()),
+      classes(2 * config.TotalEvents()),
+      states(2 * config.TotalEvents()),
+      types(2 * config.TotalEvents()),
+      slots(2 * config.TotalEvents()),
+      binary(config.maxBinaryEvents),
+      doubleBinary(config.maxDoubleBinaryEvents),
+      analog(config.maxAnalogEvents),
+      counter(config.maxCounterEvents),
+      frozenCounter(config.maxFrozenCounterEvents),
+      binaryOutputStatus(config.maxBinaryOutputStatusEvents),
+      analogOutputStatus(config.maxAnalogOutputStatusEvents),
+      octetString(config.maxOctetStringEvents)
+{
+    // every position is indexed at most once between rebuilds, so the indexes never reallocate
+    for (auto& queue : this->unselected)
+    {
+        queue.positions.reserve(this->indices.size());
+    }
+    this->selected.reserve(this->indices.size());
+}
+
+uint32_t EventRecords::Add(uint16_t index, EventClass clazz, const IEventType* type, uint32_t slot)
+{
+    if (this->end == this->indices.size())
+    {
+        // the pools bound the number of live events to half the capacity, so this frees at least that many positions
+        this->RemoveAll([](uint32_t) { return false; });
+    }
+
+    this->indices[this->end] = index;
+    this->classes[this->end] = clazz;
+    this->states[this->end] = EventState::unselected;
+    this->types[this->end] = type;
+    this->slots[this->end] = slot;
+    this->GetQueue(clazz).positions.push_back(this->end);
+
+    this->counters.OnAdd(clazz);
+
+    return this->end++;
+}
+
+void EventRecords::Remove(uint32_t position)
+{
+    this->Release(position);
+    this->states[position] = EventState::removed;
+
+    while (this->begin < this->end && this->states[this->begin] == EventState::removed)
+    {
+        ++this->begin;
+    }
+}
+
+void EventRecords::Select(uint32_t position)
+{
+    this->states[position] = EventState::selected;
+
+    if (!this->selected.empty() && position < this->selected.back())
+    {
+        this->selected_in_order = false;
+    }
+    this->selected.push_back(position);
+
+    this->counters.OnSelect();
+}
+
+void EventRecords::MarkWritten(uint32_t position)
+{
+    this->states[position] = EventState::written;
+    this->counters.OnWrite(this->classes[position]);
+}
+
+void EventRecords::UnselectAll()
+{
+    for (auto position = this->begin; position < this->end; ++position)
+    {
+        if (this->states[position] != EventState::removed)
+        {
+            this->states[position] = EventState::unselected;
+        }
+    }
+
+    // keep the total, but clear the selected/written
+    this->counters.ResetOnFail();
+
+    this->RebuildIndexes();
+}
+
+uint32_t EventRecords::FirstUnselected(EventClass clazz)
+{
+    auto& queue = this->GetQueue(clazz);
+
+    while (queue.head < queue.positions.size())
+    {
+        const auto position = queue.positions[queue.head];
+        if (this->states[position] == EventState::unselected)
+        {
+            return position;
+        }
+
+        // selected or removed since it was queued
+        ++queue.head;
+    }
+
+    return this->end;
+}
+
+void EventRecords::PrepareSelected()
+{
+    const auto is_stale = [this](uint32_t position) { return this->states[position] != EventState::selected; };
+    this->selected.erase(std::remove_if(this->selected.begin(), this->selected.end(), is_stale), this->selected.end());
+
+    if (!this->selected_in_order)
+    {
+        std::sort(this->selected.begin(), this->selected.end());
+        this->selected_in_order = true;
+    }
+}
+
+void EventRecords::RebuildIndexes()
+{
+    for (auto& queue : this->unselected)
+    {
+        queue.positions.clear();
+        queue.head = 0;
+    }
+
+    this->selected.clear();
+    this->selected_in_order = true;
+
+    for (auto position = this->begin; position < this->end; ++position)
+    {
+        switch (this->states[position])
+        {
+        case (EventState::unselected):
+            this->GetQueue(this->classes[position]).positions.push_back(position);
+            break;
+        case (EventState::selected):
+            this->selected.push_back(position);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void EventRecords::Release(uint32_t position)
+{
+    this->counters.OnRemove(this->classes[position], this->states[position]);
+    this->types[position]->RemoveTypeFromStorage(this->slots[position], *this);
+}
+
+void EventRecords::ClearTypeIndexes()
+{
+    this->binary.ClearPositions();
+    this->doubleBinary.ClearPositions();
+    this->analog.ClearPositions();
+    this->counter.ClearPositions();
+    this->frozenCounter.ClearPositions();
+    this->binaryOutputStatus.ClearPositions();
+    this->analogOutputStatus.ClearPositions();
+    this->octetString.ClearPositions();
+}
+
+bool EventRecords::IsAnyTypeFull() const
+{
+    return this->binary.IsFullAndCapacityNotZero() || this->doubleBinary.IsFullAndCapacityNotZero()
+        || this->counter.IsFullAndCapacityNotZero() || this->frozenCounter.IsFullAndCapacityNotZero()
+        || this->analog.IsFullAndCapacityNotZero() || this->binaryOutputStatus.IsFullAndCapacityNotZero()
+        || this->analogOutputStatus.IsFullAndCapacityNotZero() || this->octetString.IsFullAndCapacityNotZero();
+}
+
+template<> TypedEventPool<TypedEventRecord<BinarySpec>>& EventRecords::GetPool()
+{
+    return this->binary;
+}
+
+template<> TypedEventPool<TypedEventRecord<DoubleBitBinarySpec>>& EventRecords::GetPool()
+{
+    return this->doubleBinary;
+}
+
+template<> TypedEventPool<TypedEventRecord<CounterSpec>>& EventRecords::GetPool()
+{
+    return this->counter;
+}
+
+template<> TypedEventPool<TypedEventRecord<FrozenCounterSpec>>& EventRecords::GetPool()
+{
+    return this->frozenCounter;
+}
+
+template<> TypedEventPool<TypedEventRecord<AnalogSpec>>& EventRecords::GetPool()
+{
+    return this->analog;
+}
+
+template<> TypedEventPool<TypedEventRecord<BinaryOutputStatusSpec>>& EventRecords::GetPool()
+{
+    return this->binaryOutputStatus;
+}
+
+template<> TypedEventPool<TypedEventRecord<AnalogOutputStatusSpec>>& EventRecords::GetPool()
+{
+    return this->analogOutputStatus;
+}
+
+template<> TypedEventPool<TypedEventRecord<OctetStringSpec>>& EventRecords::GetPool()
+{
+    return this->octetString;
+}
+
+} // namespace opendnp3
@@ -0,0 +1,281 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_EVENTRECORDS_H
+#define OPENDNP3_EVENTRECORDS_H
+
+#include "ClazzCount.h"
+#include "EventState.h"
+#include "IEventType.h"
+#include "TypedEventPool.h"
+#include "TypedEventRecord.h"
+#include "app/MeasurementTypeSpecs.h"
+#include "outstation/Event.h"
+#include "outstation/OctetArena.h"
+
+#include "opendnp3/outstation/EventBufferConfig.h"
+#include "opendnp3/util/Uncopyable.h"
+
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * Stores the events in the order they were added
+ *
+ * The generic information of every event (index, class, state, type and the slot holding the typed details) is
+ * kept as a structure of parallel arrays, so that selection and writing are sequential scans. The typed details
+ * live in a fixed capacity pool per type. Octet string values are kept in an arena that only holds their actual
+ * length, which is the one structure that grows after initialization.
+ *
+ * Removing an event only marks its position as EventState::removed. The arrays are twice the total capacity of
+ * the pools and the live events are compacted to the front when the end of the arrays is reached, so that adding
+ * an event is amortized O(1). Only performs dynamic allocation at initialization.
+ *
+ * Three indexes are maintained incrementally so that polls only visit the events they touch:
+ *
+ * - a queue per class of the positions of the unselected events, in insertion order
+ * - the positions of the selected events, in the order they were selected
+ * - the positions of the events of each type, in insertion order, held by the pool of the type
+ *
+ * Entries whose state has since changed are skipped and discarded lazily. The indexes are rebuilt when the
+ * positions change during compaction, and the class and selected indexes when the events are unselected.
+ */
+class EventRecords : private Uncopyable
+{
+public:
+    EventRecords() = delete;
+
+    explicit EventRecords(const EventBufferConfig& config);
+
+    // the events occupy positions in [Begin(), End()), interleaved with removed positions
+    uint32_t Begin() const
+    {
+        return this->begin;
+    }
+
+    uint32_t End() const
+    {
+        return this->end;
+    }
+
+    uint16_t Index(uint32_t position) const
+    {
+        return this->indices[position];
+    }
+
+    EventClass Class(uint32_t position) const
+    {
+        return this->classes[position];
+    }
+
+    EventState State(uint32_t position) const
+    {
+        return this->states[position];
+    }
+
+    const IEventType* Type(uint32_t position) const
+    {
+        return this->types[position];
+    }
+
+    // the slot holding the typed details in the pool of the event's type
+    uint32_t Slot(uint32_t position) const
+    {
+        return this->slots[position];
+    }
+
+    // append an event whose typed details are already stored in a slot of its pool
+    // @return the position of the event
+    uint32_t Add(uint16_t index, EventClass clazz, const IEventType* type, uint32_t slot);
+
+    // remove the event at a position
+    void Remove(uint32_t position);
+
+    // remove every event matching a predicate on its position, compacting the remaining events
+    template<class F> uint32_t RemoveAll(const F& match);
+
+    // mark an unselected event as selected
+    void Select(uint32_t position);
+
+    // mark a selected event as written
+    void MarkWritten(uint32_t position);
+
+    // revert all selected and written events to unselected
+    void UnselectAll();
+
+    // @return the position of the oldest unselected event of a class, or End() if there is none
+    uint32_t FirstUnselected(EventClass clazz);
+
+    // discard the stale entries of the selected index and restore insertion order before writing
+    void PrepareSelected();
+
+    // the number of entries in the selected index
+    uint32_t NumSelectedEntries() const
+    {
+        return static_cast<uint32_t>(this->selected.size());
+    }
+
+    // the position of an entry in the selected index
+    uint32_t SelectedPosition(uint32_t entry) const
+    {
+        return this->selected[entry];
+    }
+
+    template<class T> TypedEventPool<TypedEventRecord<T>>& GetPool();
+
+    // append a position to the index of the events of a type
+    template<class T> void IndexPosition(uint32_t position)
+    {
+        this->GetPool<T>().AddPosition(position, [this](uint32_t p) { return this->IsRemoved(p); });
+    }
+
+    // @return the position of the oldest event of a type, or End() if there is none
+    template<class T> uint32_t FirstOfType()
+    {
+        auto& pool = this->GetPool<T>();
+        pool.SkipPositions([this](uint32_t p) { return this->IsRemoved(p); });
+        return pool.NumPositions() > 0 ? pool.Position(0) : this->end;
+    }
+
+    // ---- conversions between events and the typed details stored in the pools ----
+
+    template<class T> TypedEventRecord<T> CreateTypedRecord(const Event<T>& event)
+    {
+        return TypedEventRecord<T>(event.value, event.variation);
+    }
+
+    TypedEventRecord<OctetStringSpec> CreateTypedRecord(const Event<OctetStringSpec>& event)
+    {
+        return TypedEventRecord<OctetStringSpec>(this->octets.Allocate(event.value.ToBuffer()), event.variation);
+    }
+
+    template<class T> const typename T::meas_t& GetValue(const TypedEventRecord<T>& record) const
+    {
+        return record.value;
+    }
+
+    OctetString GetValue(const TypedEventRecord<OctetStringSpec>& record) const
+    {
+        OctetString value;
+        value.Set(this->octets.Get(record.value));
+        return value;
+    }
+
+    template<class T> void ReleaseValue(const TypedEventRecord<T>& record) {}
+
+    void ReleaseValue(const TypedEventRecord<OctetStringSpec>& record)
+    {
+        this->octets.Free(record.value);
+    }
+
+    bool IsAnyTypeFull() const;
+
+    EventClassCounters counters;
+
+private:
+    // release the typed storage and update the counters for the event at a position
+    void Release(uint32_t position);
+
+    bool IsRemoved(uint32_t position) const
+    {
+        return this->states[position] == EventState::removed;
+    }
+
+    void ClearTypeIndexes();
+
+    void RebuildIndexes();
+
+    struct ClassQueue
+    {
+        std::vector<uint32_t> positions;
+        size_t head = 0;
+    };
+
+    ClassQueue& GetQueue(EventClass clazz)
+    {
+        return this->unselected[static_cast<uint8_t>(clazz)];
+    }
+
+    uint32_t begin = 0;
+    uint32_t end = 0;
+
+    std::vector<uint16_t> indices;
+    std::vector<EventClass> classes;
+    std::vector<EventState> states;
+    std::vector<const IEventType*> types;
+    std::vector<uint32_t> slots;
+
+    ClassQueue unselected[3];
+    std::vector<uint32_t> selected;
+    bool selected_in_order = true;
+
+    TypedEventPool<TypedEventRecord<BinarySpec>> binary;
+    TypedEventPool<TypedEventRecord<DoubleBitBinarySpec>> doubleBinary;
+    TypedEventPool<TypedEventRecord<AnalogSpec>> analog;
+    TypedEventPool<TypedEventRecord<CounterSpec>> counter;
+    TypedEventPool<TypedEventRecord<FrozenCounterSpec>> frozenCounter;
+    TypedEventPool<TypedEventRecord<BinaryOutputStatusSpec>> binaryOutputStatus;
+    TypedEventPool<TypedEventRecord<AnalogOutputStatusSpec>> analogOutputStatus;
+    TypedEventPool<TypedEventRecord<OctetStringSpec>> octetString;
+
+    OctetArena octets;
+};
+
+template<class F> uint32_t EventRecords::RemoveAll(const F& match)
+{
+    uint32_t num_removed = 0;
+    uint32_t dest = 0;
+
+    this->ClearTypeIndexes();
+
+    for (auto position = this->begin; position < this->end; ++position)
+    {
+        if (this->states[position] == EventState::removed)
+        {
+            continue;
+        }
+
+        if (match(position))
+        {
+            this->Release(position);
+            ++num_removed;
+            continue;
+        }
+
+        this->indices[dest] = this->indices[position];
+        this->classes[dest] = this->classes[position];
+        this->states[dest] = this->states[position];
+        this->types[dest] = this->types[position];
+        this->slots[dest] = this->slots[position];
+        this->types[dest]->IndexPosition(dest, *this);
+        ++dest;
+    }
+
+    this->begin = 0;
+    this->end = dest;
+    this->RebuildIndexes();
+
+    return num_removed;
+}
+
+} // namespace opendnp3
+
+#endif
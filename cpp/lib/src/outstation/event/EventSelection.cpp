@@ -20,26 +20,38 @@
 
 #include "EventSelection.h"
 
+#include <algorithm>
+
 namespace opendnp3
 {
 
-uint32_t EventSelection::SelectByClass(EventLists& lists, const ClassField& clazz, uint32_t max)
+uint32_t EventSelection::SelectByClass(EventRecords& records, const ClassField& clazz, uint32_t max)
 {
+    const EventClass classes[] = {EventClass::EC1, EventClass::EC2, EventClass::EC3};
+
     uint32_t num_selected = 0;
-    auto iter = lists.events.Iterate();
 
-    while (iter.HasNext() && num_selected < max)
+    while (num_selected < max)
     {
-        auto node = iter.Next();
-        if (node->value.state == EventState::unselected && clazz.HasEventType(node->value.clazz))
+        // merge the per-class indexes to select the oldest unselected event of the requested classes
+        auto position = records.End();
+        for (auto ec : classes)
+        {
+            if (clazz.HasEventType(ec))
+            {
+                position = std::min(position, records.FirstUnselected(ec));
+            }
+        }
+
+        if (position == records.End())
         {
-            // if not previously selected
-            node->value.state = EventState::selected;
-            // TODO - set the storage to use the default variation
-            // node->value.selectedVariation = useDefaultVariation ? node->value.defaultVariation : variation;
-            ++num_selected;
-            lists.counters.OnSelect();
+            break;
         }
+
+        // TODO - set the storage to use the default variation
+        // node->value.selectedVariation = useDefaultVariation ? node->value.defaultVariation : variation;
+        records.Select(position);
+        ++num_selected;
     }
 
     return num_selected;
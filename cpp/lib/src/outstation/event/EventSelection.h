@@ -20,7 +20,8 @@
 #ifndef OPENDNP3_EVENTSELECTION_H
 #define OPENDNP3_EVENTSELECTION_H
 
-#include "EventLists.h"
+#include "EventRecords.h"
+#include "EventTypeImpl.h"
 
 #include "opendnp3/app/ClassField.h"
 
@@ -29,53 +30,49 @@ namespace opendnp3
 
 struct EventSelection : private StaticOnly
 {
-    template<class T> static uint32_t SelectByType(EventLists& lists, uint32_t max)
+    template<class T> static uint32_t SelectByType(EventRecords& records, uint32_t max)
     {
-        return SelectByTypeGeneric<T>(lists, true, static_cast<typename T::event_variation_t>(0), max);
+        return SelectByTypeGeneric<T>(records, true, static_cast<typename T::event_variation_t>(0), max);
     }
 
     template<class T>
-    static uint32_t SelectByType(EventLists& lists, typename T::event_variation_t variation, uint32_t max)
+    static uint32_t SelectByType(EventRecords& records, typename T::event_variation_t variation, uint32_t max)
     {
-        return SelectByTypeGeneric<T>(lists, false, variation, max);
+        return SelectByTypeGeneric<T>(records, false, variation, max);
     }
 
-    static uint32_t SelectByClass(EventLists& lists, const ClassField& clazz, uint32_t max);
+    static uint32_t SelectByClass(EventRecords& records, const ClassField& clazz, uint32_t max);
 
 private:
     template<class T>
-    static uint32_t SelectByTypeGeneric(EventLists& lists,
+    static uint32_t SelectByTypeGeneric(EventRecords& records,
                                         bool useDefaultVariation,
                                         typename T::event_variation_t variation,
                                         uint32_t max);
 };
 
 template<class T>
-uint32_t EventSelection::SelectByTypeGeneric(EventLists& lists,
+uint32_t EventSelection::SelectByTypeGeneric(EventRecords& records,
                                              bool useDefaultVariation,
                                              typename T::event_variation_t variation,
                                              uint32_t max)
 {
-    auto& list = lists.GetList<T>();
+    // only visits the events of this type, via the index of positions held by its pool
+    auto& pool = records.GetPool<T>();
 
     uint32_t num_selected = 0;
 
-    auto select = [&](TypedEventRecord<T>& node) -> bool {
-        if (num_selected == max)
-            return false;
-
-        if (node.record->value.state == EventState::unselected)
+    for (uint32_t entry = 0; entry < pool.NumPositions() && num_selected < max; ++entry)
+    {
+        const auto position = pool.Position(entry);
+        if (records.State(position) == EventState::unselected)
         {
-            node.record->value.state = EventState::selected;
+            auto& node = pool[records.Slot(position)];
             node.selectedVariation = useDefaultVariation ? node.defaultVariation : variation;
-            lists.counters.OnSelect();
+            records.Select(position);
             ++num_selected;
         }
-
-        return true;
-    };
-
-    list.ForeachWhile(select);
+    }
 
     return num_selected;
 }
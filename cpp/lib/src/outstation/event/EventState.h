@@ -32,7 +32,8 @@ enum class EventState : uint8_t
 {
     unselected,
     selected,
-    written
+    written,
+    removed // the position no longer holds an event
 };
 
 } // namespace opendnp3
@@ -177,28 +177,14 @@ uint32_t EventStorage::Write(IEventWriteHandler& handler)
 
 uint32_t EventStorage::ClearWritten()
 {
-    auto written = [this](EventRecord& record) -> bool {
-        if (record.state == EventState::written)
-        {
-            record.type->RemoveTypeFromStorage(record, this->state);
-            this->state.counters.OnRemove(record.clazz, record.state);
-            return true;
-        }
+    auto written = [this](uint32_t position) -> bool { return this->state.State(position) == EventState::written; };
 
-        return false;
-    };
-
-    return this->state.events.RemoveAll(written);
+    return this->state.RemoveAll(written);
 }
 
 void EventStorage::Unselect()
 {
-    auto clear = [](EventRecord& record) -> void { record.state = EventState::unselected; };
-
-    this->state.events.Foreach(clear);
-
-    // keep the total, but clear the selected/written
-    this->state.counters.ResetOnFail();
+    this->state.UnselectAll();
 }
 
 } // namespace opendnp3
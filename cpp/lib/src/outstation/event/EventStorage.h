@@ -20,7 +20,7 @@
 #ifndef OPENDNP3_EVENTSTORAGE_H
 #define OPENDNP3_EVENTSTORAGE_H
 
-#include "EventLists.h"
+#include "EventRecords.h"
 #include "IEventWriteHandler.h"
 #include "outstation/Event.h"
 
@@ -35,7 +35,7 @@ namespace opendnp3
     Data-stucture for holding events.
 
     * Only performs dynamic allocation at initialization
-    * Maintains distinct lists for each type of event to optimize memory usage
+    * Maintains distinct pools for each type of event to optimize memory usage
 */
 
 class EventStorage
@@ -94,7 +94,7 @@ public:
     uint32_t SelectByClass(const ClassField& clazz, uint32_t max);
 
 private:
-    EventLists state;
+    EventRecords state;
 };
 
 } // namespace opendnp3
@@ -43,28 +43,31 @@ public:
         return &instance;
     }
 
-    virtual void SelectDefaultVariation(EventRecord& record) const override
+    virtual void SelectDefaultVariation(uint32_t slot, EventRecords& records) const override
     {
-        auto node = TypedStorage<T>::Retrieve(record);
-        node->value.selectedVariation = node->value.defaultVariation;
+        auto& node = records.GetPool<T>()[slot];
+        node.selectedVariation = node.defaultVariation;
     }
 
-    virtual uint16_t WriteSome(List<EventRecord>::Iterator& iterator,
-                               EventLists& lists,
-                               IEventWriteHandler& handler) const override
+    virtual uint16_t WriteSome(uint32_t& cursor, EventRecords& records, IEventWriteHandler& handler) const override
     {
-        const auto pos = iterator.CurrentValue();
-        const auto type = TypedStorage<T>::Retrieve(*pos);
+        const auto& node = records.GetPool<T>()[records.Slot(records.SelectedPosition(cursor))];
 
-        EventCollection<T> collection(iterator, lists.counters, type->value.selectedVariation);
+        EventCollection<T> collection(cursor, records, node.selectedVariation);
 
-        return handler.Write(type->value.selectedVariation, type->value.value, collection);
+        return handler.Write(node.selectedVariation, records.GetValue(node), collection);
     }
 
-    virtual void RemoveTypeFromStorage(EventRecord& record, EventLists& lists) const override
+    virtual void IndexPosition(uint32_t position, EventRecords& records) const override
     {
-        auto node = TypedStorage<T>::Retrieve(record);
-        lists.GetList<T>().Remove(node);
+        records.IndexPosition<T>(position);
+    }
+
+    virtual void RemoveTypeFromStorage(uint32_t slot, EventRecords& records) const override
+    {
+        auto& pool = records.GetPool<T>();
+        records.ReleaseValue(pool[slot]);
+        pool.Remove(slot);
     }
 };
 
@@ -20,7 +20,7 @@
 #ifndef OPENDNP3_EVENTUPDATE_H
 #define OPENDNP3_EVENTUPDATE_H
 
-#include "EventLists.h"
+#include "EventRecords.h"
 #include "EventTypeImpl.h"
 #include "outstation/Event.h"
 
@@ -29,46 +29,31 @@ namespace opendnp3
 
 struct EventUpdate : private StaticOnly
 {
-    template<class T> static bool Update(EventLists& lists, const Event<T>& event);
+    template<class T> static bool Update(EventRecords& records, const Event<T>& event);
 };
 
-template<class T> bool EventUpdate::Update(EventLists& lists, const Event<T>& event)
+template<class T> bool EventUpdate::Update(EventRecords& records, const Event<T>& event)
 {
-    auto& list = lists.GetList<T>();
+    auto& pool = records.GetPool<T>();
 
-    // lists with no capacity don't cause "buffer overflow"
-    if (list.Capacity() == 0)
+    // pools with no capacity don't cause "buffer overflow"
+    if (pool.Capacity() == 0)
         return false;
 
     bool overflow = false;
 
-    if (list.IsFullAndCapacityNotZero())
+    if (pool.IsFullAndCapacityNotZero())
     {
-        // we must make space
+        // we must make space by removing the oldest event of this type
 
         overflow = true;
-        const auto first = list.Head();
-        const auto record_node = first->value.record;
-
-        // remove the generic record
-        lists.counters.OnRemove(record_node->value.clazz, record_node->value.state);
-        lists.events.Remove(first->value.record);
-
-        // remove the type specific record
-        list.Remove(first);
+        records.Remove(records.FirstOfType<T>());
     }
 
-    // now that we know that space exists, create the generic record
-    const auto record_node = lists.events.Add(EventRecord(event.index, event.clazz));
-
-    // followed by the typed record
-    const auto typed_node = list.Add(TypedEventRecord<T>(event.value, event.variation, record_node));
-
-    // configure the typed storage
-    record_node->value.type = EventTypeImpl<T>::Instance();
-    record_node->value.storage_node = typed_node;
-
-    lists.counters.OnAdd(event.clazz);
+    // now that we know that space exists, store the typed record followed by the generic record
+    const auto slot = pool.Add(records.CreateTypedRecord(event));
+    const auto position = records.Add(event.index, event.clazz, EventTypeImpl<T>::Instance(), slot);
+    records.IndexPosition<T>(position);
 
     return overflow;
 }
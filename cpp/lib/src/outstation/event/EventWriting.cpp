@@ -26,16 +26,18 @@
 namespace opendnp3
 {
 
-uint32_t EventWriting::Write(EventLists& lists, IEventWriteHandler& handler)
+uint32_t EventWriting::Write(EventRecords& records, IEventWriteHandler& handler)
 {
     uint32_t total_num_written = 0;
 
-    auto iterator = lists.events.Iterate();
+    // walk the selected index instead of the whole buffer
+    records.PrepareSelected();
+    uint32_t cursor = 0;
 
     while (true)
     {
         // continue calling WriteSome(..) until it fails to make progress
-        auto num_written = WriteSome(iterator, lists, handler);
+        auto num_written = WriteSome(cursor, records, handler);
 
         if (num_written == 0)
         {
@@ -46,36 +48,37 @@ uint32_t EventWriting::Write(EventLists& lists, IEventWriteHandler& handler)
     }
 }
 
-EventRecord* EventWriting::FindNextSelected(event_iter_t& iter, EventType type)
+bool EventWriting::FindNextSelected(uint32_t& cursor, const EventRecords& records, EventType type)
 {
-    while (true)
+    for (; cursor < records.NumSelectedEntries(); ++cursor)
     {
-        auto current = iter.CurrentValue();
-        if (!current)
-            return nullptr;
-
-        if (current->state == EventState::selected)
+        const auto position = records.SelectedPosition(cursor);
+        if (records.State(position) == EventState::selected)
         {
             // we terminate here since the type has changed
-            return current->type->IsEqual(type) ? current : nullptr;
+            return records.Type(position)->IsEqual(type);
         }
-
-        iter.Next();
     }
+
+    return false;
 }
 
-uint16_t EventWriting::WriteSome(event_iter_t& iterator, EventLists& lists, IEventWriteHandler& handler)
+uint16_t EventWriting::WriteSome(uint32_t& cursor, EventRecords& records, IEventWriteHandler& handler)
 {
     // don't bother searching
-    if (lists.counters.selected == 0)
+    if (records.counters.selected == 0)
         return 0;
 
-    const auto value = iterator.Find([](const EventRecord& record) { return record.state == EventState::selected; });
+    while (cursor < records.NumSelectedEntries()
+           && records.State(records.SelectedPosition(cursor)) != EventState::selected)
+    {
+        ++cursor;
+    }
 
-    if (!value)
+    if (cursor == records.NumSelectedEntries())
         return 0; // no match
 
-    return value->type->WriteSome(iterator, lists, handler);
+    return records.Type(records.SelectedPosition(cursor))->WriteSome(cursor, records, handler);
 }
 
 } // namespace opendnp3
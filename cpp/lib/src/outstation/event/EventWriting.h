@@ -20,7 +20,7 @@
 #ifndef OPENDNP3_EVENTWRITING_H
 #define OPENDNP3_EVENTWRITING_H
 
-#include "EventLists.h"
+#include "EventRecords.h"
 #include "IEventWriteHandler.h"
 
 namespace opendnp3
@@ -30,15 +30,13 @@ class EventWriting : private StaticOnly
 {
 
 public:
-    static uint32_t Write(EventLists& lists, IEventWriteHandler& handler);
+    static uint32_t Write(EventRecords& records, IEventWriteHandler& handler);
 
-    static EventRecord* FindNextSelected(event_iter_t& iter, EventType type);
-
-    template<class T>
-    static uint16_t WriteSomeOfType(event_iter_t& iterator, EventLists& lists, IEventWriteHandler& handler);
+    // advance the cursor in the selected index to the next selected event, returning true if it has the specified type
+    static bool FindNextSelected(uint32_t& cursor, const EventRecords& records, EventType type);
 
 private:
-    static uint16_t WriteSome(event_iter_t& iterator, EventLists& lists, IEventWriteHandler& handler);
+    static uint16_t WriteSome(uint32_t& cursor, EventRecords& records, IEventWriteHandler& handler);
 };
 
 } // namespace opendnp3
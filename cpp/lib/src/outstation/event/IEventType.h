@@ -21,16 +21,15 @@
 #ifndef OPENDNP3_IEVENTTYPE_H
 #define OPENDNP3_IEVENTTYPE_H
 
-#include "List.h"
-
 #include "opendnp3/app/EventType.h"
 
+#include <cstdint>
+
 namespace opendnp3
 {
 
-class EventLists;
+class EventRecords;
 class IEventWriteHandler;
-class EventRecord;
 
 class IEventType
 {
@@ -52,13 +51,15 @@ protected:
     IEventType(EventType value) : value(value) {}
 
 public:
-    virtual void SelectDefaultVariation(EventRecord& record) const = 0;
+    virtual void SelectDefaultVariation(uint32_t slot, EventRecords& records) const = 0;
+
+    // write events starting at a cursor in the selected index of the records
+    virtual uint16_t WriteSome(uint32_t& cursor, EventRecords& records, IEventWriteHandler& handler) const = 0;
 
-    virtual uint16_t WriteSome(List<EventRecord>::Iterator& iterator,
-                               EventLists& lists,
-                               IEventWriteHandler& handler) const = 0;
+    // append a position to the index of the events of this type
+    virtual void IndexPosition(uint32_t position, EventRecords& records) const = 0;
 
-    virtual void RemoveTypeFromStorage(EventRecord& record, EventLists& lists) const = 0;
+    virtual void RemoveTypeFromStorage(uint32_t slot, EventRecords& records) const = 0;
 };
 
 } // namespace opendnp3
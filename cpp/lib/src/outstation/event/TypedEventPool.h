@@ -0,0 +1,140 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OPENDNP3_TYPEDEVENTPOOL_H
+#define OPENDNP3_TYPEDEVENTPOOL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace opendnp3
+{
+
+/**
+ * Fixed capacity storage for values of a single type, addressed by slot
+ *
+ * Only performs dynamic allocation at initialization. Freed slots are recycled last-in first-out.
+ *
+ * Also indexes the positions of its records in the EventRecords, in insertion order, so that the events of a
+ * single type can be visited without scanning the events of the other types.
+ */
+template<class T> class TypedEventPool
+{
+public:
+    explicit TypedEventPool(uint32_t capacity) : records(capacity)
+    {
+        this->free_slots.reserve(capacity);
+        for (uint32_t slot = capacity; slot > 0; --slot)
+        {
+            this->free_slots.push_back(slot - 1);
+        }
+        this->positions.reserve(2 * capacity);
+    }
+
+    uint32_t Capacity() const
+    {
+        return static_cast<uint32_t>(this->records.size());
+    }
+
+    uint32_t Size() const
+    {
+        return this->Capacity() - static_cast<uint32_t>(this->free_slots.size());
+    }
+
+    bool IsFullAndCapacityNotZero() const
+    {
+        return this->free_slots.empty() && this->Capacity() > 0;
+    }
+
+    // the pool must not be full
+    uint32_t Add(const T& value)
+    {
+        const auto slot = this->free_slots.back();
+        this->free_slots.pop_back();
+        this->records[slot] = value;
+        return slot;
+    }
+
+    void Remove(uint32_t slot)
+    {
+        this->free_slots.push_back(slot);
+    }
+
+    T& operator[](uint32_t slot)
+    {
+        return this->records[slot];
+    }
+
+    const T& operator[](uint32_t slot) const
+    {
+        return this->records[slot];
+    }
+
+    // ---- the index of the positions of the records ----
+
+    // append the position of a new record. When the index is full, the entries matching the predicate (removed
+    // records) are discarded first, which frees at least half of it since live records are bounded by the capacity
+    template<class F> void AddPosition(uint32_t position, const F& is_removed)
+    {
+        if (this->positions.size() == this->positions.capacity())
+        {
+            this->positions.erase(std::remove_if(this->positions.begin(), this->positions.end(), is_removed),
+                                  this->positions.end());
+            this->head = 0;
+        }
+        this->positions.push_back(position);
+    }
+
+    // discard the entries matching the predicate (removed records) from the front of the index
+    template<class F> void SkipPositions(const F& is_removed)
+    {
+        while (this->head < this->positions.size() && is_removed(this->positions[this->head]))
+        {
+            ++this->head;
+        }
+    }
+
+    uint32_t NumPositions() const
+    {
+        return static_cast<uint32_t>(this->positions.size() - this->head);
+    }
+
+    uint32_t Position(uint32_t entry) const
+    {
+        return this->positions[this->head + entry];
+    }
+
+    void ClearPositions()
+    {
+        this->positions.clear();
+        this->head = 0;
+    }
+
+private:
+    std::vector<T> records;
+    std::vector<uint32_t> free_slots;
+
+    std::vector<uint32_t> positions;
+    size_t head = 0;
+};
+
+} // namespace opendnp3
+
+#endif
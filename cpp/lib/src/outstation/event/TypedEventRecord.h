@@ -20,7 +20,10 @@
 #ifndef OPENDNP3_TYPEDEVENTRECORD_H
 #define OPENDNP3_TYPEDEVENTRECORD_H
 
-#include "EventRecord.h"
+#include "app/MeasurementTypeSpecs.h"
+#include "outstation/OctetArena.h"
+
+#include <cstdint>
 
 namespace opendnp3
 {
@@ -32,18 +35,33 @@ template<class T> struct TypedEventRecord
 {
     TypedEventRecord() = default;
 
-    TypedEventRecord(const typename T::meas_t& value,
-                     typename T::event_variation_t defaultVariation,
-                     Node<EventRecord>* record)
-        : value(value), defaultVariation(defaultVariation), selectedVariation(defaultVariation), record(record)
+    TypedEventRecord(const typename T::meas_t& value, typename T::event_variation_t defaultVariation)
+        : value(value), defaultVariation(defaultVariation), selectedVariation(defaultVariation)
     {
     }
 
     typename T::meas_t value;
     typename T::event_variation_t defaultVariation;
     typename T::event_variation_t selectedVariation;
-    Node<EventRecord>* record = nullptr;
 };
+
+/**
+ * Octet string details refer to the value in the arena of the EventRecords
+ */
+template<> struct TypedEventRecord<OctetStringSpec>
+{
+    TypedEventRecord() = default;
+
+    TypedEventRecord(OctetArena::handle_t value, OctetStringSpec::event_variation_t defaultVariation)
+        : value(value), defaultVariation(defaultVariation), selectedVariation(defaultVariation)
+    {
+    }
+
+    OctetArena::handle_t value = 0;
+    OctetStringSpec::event_variation_t defaultVariation;
+    OctetStringSpec::event_variation_t selectedVariation;
+};
+
 } // namespace opendnp3
 
 #endif
@@ -75,6 +75,11 @@ bool TransportLayer::BeginTransmit(const Message& message)
 // IUpperLayer
 ///////////////////////////////////////
 
+ser4cpp::wseq_t TransportLayer::GetSegmentBuffer(size_t length)
+{
+    return isOnline ? receiver.GetSegmentBuffer(length) : ser4cpp::wseq_t::empty();
+}
+
 bool TransportLayer::OnReceive(const Message& message)
 {
     if (isOnline)
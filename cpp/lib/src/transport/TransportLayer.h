@@ -53,6 +53,9 @@ public:
     virtual bool OnLowerLayerDown() override;
     virtual bool OnTxReady() override;
 
+    // buffer into which the link layer can de-CRC a segment so that it is reassembled without a copy
+    ser4cpp::wseq_t GetSegmentBuffer(size_t length);
+
     void SetAppLayer(IUpperLayer& upperLayer);
 
     void SetLinkLayer(ILinkLayer& linkLayer);
@@ -33,12 +33,13 @@ namespace opendnp3
 {
 
 TransportRx::TransportRx(const Logger& logger, uint32_t maxRxFragSize)
-    : logger(logger), rxBuffer(maxRxFragSize), numBytesRead(0)
+    : logger(logger), rxBuffer(maxRxFragSize + 1), numBytesRead(0)
 {
 }
 
 void TransportRx::Reset()
 {
+    this->RestoreDisplacedByte();
     this->ClearRxBuffer();
 }
 
@@ -49,7 +50,33 @@ void TransportRx::ClearRxBuffer()
 
 ser4cpp::wseq_t TransportRx::GetAvailable()
 {
-    return rxBuffer.as_wslice().skip(numBytesRead);
+    return rxBuffer.as_wslice().skip(1 + numBytesRead);
+}
+
+ser4cpp::wseq_t TransportRx::GetSegmentBuffer(size_t length)
+{
+    this->RestoreDisplacedByte();
+
+    if (length == 0 || (length - 1) > this->GetAvailable().length())
+    {
+        return ser4cpp::wseq_t::empty();
+    }
+
+    // the header goes on the byte just before the next payload byte
+    this->hasDisplacedByte = true;
+    this->displacedPosition = this->numBytesRead;
+    this->displacedByte = rxBuffer.as_wslice()[this->displacedPosition];
+
+    return rxBuffer.as_wslice().skip(this->displacedPosition).take(length);
+}
+
+void TransportRx::RestoreDisplacedByte()
+{
+    if (this->hasDisplacedByte)
+    {
+        rxBuffer.as_wslice()[this->displacedPosition] = this->displacedByte;
+        this->hasDisplacedByte = false;
+    }
 }
 
 Message TransportRx::ProcessReceive(const Message& segment)
@@ -63,7 +90,9 @@ Message TransportRx::ProcessReceive(const Message& segment)
         return Message();
     }
 
+    // read the header before it is overwritten by restoring the byte it displaced
     const TransportHeader header(segment.payload[0]);
+    this->RestoreDisplacedByte();
 
     const auto payload = segment.payload.skip(1);
 
@@ -118,7 +147,12 @@ Message TransportRx::ProcessReceive(const Message& segment)
         return Message();
     }
 
-    available.copy_from(payload);
+    // segments written in place by the link layer are already where they belong
+    if (static_cast<const uint8_t*>(payload) != available)
+    {
+        // the payload may overlap the fragment if an in-place segment restarted it
+        available.move_from(payload);
+    }
 
     this->numBytesRead += payload.length();
     this->lastAddresses = segment.addresses;
@@ -127,7 +161,7 @@ Message TransportRx::ProcessReceive(const Message& segment)
 
     if (header.fin)
     {
-        const auto ret = rxBuffer.as_rslice().take(numBytesRead);
+        const auto ret = rxBuffer.as_rslice().skip(1).take(numBytesRead);
         this->numBytesRead = 0;
         return Message(segment.addresses, ret);
     }
@@ -44,6 +44,16 @@ public:
 
     Message ProcessReceive(const Message& segment);
 
+    /**
+     * Provides a buffer into which the link layer can write a whole segment, header included, such that its payload
+     * lands directly behind the bytes already reassembled. A segment written there is appended without a copy.
+     *
+     * The header byte temporarily displaces the last reassembled byte, which is restored before any other access.
+     *
+     * @return a buffer of exactly the requested length, or an empty buffer if the payload would not fit
+     */
+    ser4cpp::wseq_t GetSegmentBuffer(size_t length);
+
     void Reset();
 
     const StackStatistics::Transport::Rx& Statistics() const
@@ -56,13 +66,21 @@ private:
 
     void ClearRxBuffer();
 
+    void RestoreDisplacedByte();
+
     Logger logger;
     StackStatistics::Transport::Rx statistics;
 
+    // the fragment starts after one byte of headroom for the header of a segment written in place
     ser4cpp::Buffer rxBuffer;
     size_t numBytesRead;
     Addresses lastAddresses;
 
+    // the byte overwritten by the header of the last segment buffer handed out, if any
+    bool hasDisplacedByte = false;
+    size_t displacedPosition = 0;
+    uint8_t displacedByte = 0;
+
     TransportSeqNum expectedSeq;
 };
 
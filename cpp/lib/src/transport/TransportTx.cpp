@@ -24,8 +24,6 @@
 
 #include "opendnp3/logging/LogLevels.h"
 
-#include <ser4cpp/serialization/LittleEndian.h>
-
 #include <cassert>
 
 namespace opendnp3
@@ -36,9 +34,9 @@ TransportTx::TransportTx(const Logger& logger) : logger(logger) {}
 void TransportTx::Configure(const Message& message)
 {
     assert(message.payload.is_not_empty());
-    txSegment.clear();
     this->message = message;
     this->tpduCount = 0;
+    this->StartSegment();
 }
 
 bool TransportTx::HasValue() const
@@ -46,43 +44,44 @@ bool TransportTx::HasValue() const
     return this->message.payload.length() > 0;
 }
 
-ser4cpp::rseq_t TransportTx::GetSegment()
+uint8_t TransportTx::GetHeader()
+{
+    return this->header;
+}
+
+ser4cpp::rseq_t TransportTx::GetPayload()
 {
-    if (txSegment.is_set())
+    return this->message.payload.take(this->numToSend);
+}
+
+bool TransportTx::Advance()
+{
+    this->message.payload.advance(this->numToSend);
+    ++tpduCount;
+    sequence.Increment();
+
+    if (this->message.payload.is_empty())
     {
-        return txSegment.get();
+        return false;
     }
 
-    const size_t numToSend
-        = (this->message.payload.length() < MAX_TPDU_PAYLOAD) ? this->message.payload.length() : MAX_TPDU_PAYLOAD;
+    this->StartSegment();
+    return true;
+}
 
-    auto dest = tpduBuffer.as_wseq().skip(1);
-    dest.copy_from(this->message.payload.take(numToSend));
+void TransportTx::StartSegment()
+{
+    this->numToSend
+        = (this->message.payload.length() < MAX_TPDU_PAYLOAD) ? this->message.payload.length() : MAX_TPDU_PAYLOAD;
 
     bool fir = (tpduCount == 0);
     bool fin = (numToSend == this->message.payload.length());
-    auto destHeader = tpduBuffer.as_wseq();
-    ser4cpp::UInt8::write_to(destHeader, TransportHeader::ToByte(fir, fin, sequence));
+    this->header = TransportHeader::ToByte(fir, fin, sequence);
 
     FORMAT_LOG_BLOCK(logger, flags::TRANSPORT_TX, "FIR: %d FIN: %d SEQ: %u LEN: %zu", fir, fin, sequence.Get(),
                      numToSend);
 
     ++statistics.numTransportTx;
-
-    auto segment = tpduBuffer.as_seq(numToSend + 1);
-    txSegment.set(segment);
-    return segment;
-}
-
-bool TransportTx::Advance()
-{
-    txSegment.clear();
-    size_t numToSend
-        = this->message.payload.length() < MAX_TPDU_PAYLOAD ? this->message.payload.length() : MAX_TPDU_PAYLOAD;
-    this->message.payload.advance(numToSend);
-    ++tpduCount;
-    sequence.Increment();
-    return this->message.payload.is_not_empty();
 }
 
 } // namespace opendnp3
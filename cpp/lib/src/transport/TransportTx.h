@@ -28,8 +28,8 @@
 #include "opendnp3/StackStatistics.h"
 #include "opendnp3/logging/Logger.h"
 
-#include <ser4cpp/container/Settable.h>
-#include <ser4cpp/container/StaticBuffer.h>
+#include <cstddef>
+#include <cstdint>
 
 namespace opendnp3
 {
@@ -54,7 +54,9 @@ public:
 
     virtual bool HasValue() const override;
 
-    virtual ser4cpp::rseq_t GetSegment() override;
+    virtual uint8_t GetHeader() override;
+
+    virtual ser4cpp::rseq_t GetPayload() override;
 
     virtual bool Advance() override;
 
@@ -64,12 +66,14 @@ public:
     }
 
 private:
-    Message message;
+    // compute the header of the segment at the front of the message and record its transmission
+    void StartSegment();
 
-    ser4cpp::Settable<ser4cpp::rseq_t> txSegment;
+    // the remainder of the fragment being sent, segments are read from it in place
+    Message message;
 
-    // Static buffer where we store tpdus that are being transmitted
-    ser4cpp::StaticBuffer<MAX_TPDU_LENGTH> tpduBuffer;
+    uint8_t header = 0;
+    size_t numToSend = 0;
 
     Logger logger;
     StackStatistics::Transport::Tx statistics;
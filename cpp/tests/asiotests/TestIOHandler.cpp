@@ -0,0 +1,368 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "mocks/MockIO.h"
+
+#include <dnp3mocks/MockLogHandler.h>
+
+#include <ser4cpp/container/StaticBuffer.h>
+#include <ser4cpp/util/HexConversions.h>
+
+#include <catch.hpp>
+#include <channel/IOHandler.h>
+#include <link/LinkFrame.h>
+#include <link/LinkLayerConstants.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace opendnp3;
+using namespace ser4cpp;
+
+#define SUITE(name) "IOHandlerTestSuite - " name
+
+namespace
+{
+    class MockChannel final : public IAsyncChannel
+    {
+    public:
+        explicit MockChannel(const std::shared_ptr<exe4cpp::StrandExecutor>& executor) : IAsyncChannel(executor) {}
+
+        // complete the pending read with some data
+        void Receive(const rseq_t& data)
+        {
+            REQUIRE(data.length() <= this->readBuffer.length());
+            this->readBuffer.copy_from(data);
+            this->OnReadCallback(ASIO_ERROR(), data.length());
+        }
+
+        // complete the pending write
+        void CompleteWrite()
+        {
+            REQUIRE(this->writeLength > 0);
+            const auto length = this->writeLength;
+            this->writeLength = 0;
+            this->OnWriteCallback(ASIO_ERROR(), length);
+        }
+
+        std::vector<std::string> writes;
+
+    private:
+        void BeginReadImpl(wseq_t buffer) override
+        {
+            this->readBuffer = buffer;
+        }
+
+        void BeginWriteImpl(const rseq_t& buffer) override
+        {
+            this->writes.push_back(HexConversions::to_hex(buffer));
+            this->writeLength = buffer.length();
+        }
+
+        void ShutdownImpl() override {}
+
+        wseq_t readBuffer;
+        size_t writeLength = 0;
+    };
+
+    class MockIOHandler final : public IOHandler
+    {
+    public:
+        explicit MockIOHandler(const Logger& logger) : IOHandler(logger, false, nullptr) {}
+
+        void Open(const std::shared_ptr<IAsyncChannel>& channel)
+        {
+            this->OnNewChannel(channel);
+        }
+
+    protected:
+        void BeginChannelAccept() override {}
+        void SuspendChannelAccept() override {}
+        void ShutdownImpl() override {}
+        void OnChannelShutdown() override {}
+    };
+
+    // accepts frames sent to its route the way a link context does
+    class MockSession final : public ILinkSession
+    {
+    public:
+        MockSession(const Addresses& route, bool respondToAnySource = false)
+            : route(route), respondToAnySource(respondToAnySource)
+        {
+        }
+
+        bool OnFrame(const LinkHeaderFields& header, const rseq_t& userdata) override
+        {
+            this->received.push_back(header.addresses);
+            return (header.addresses.destination == this->route.destination)
+                && (this->respondToAnySource || header.addresses.source == this->route.source);
+        }
+
+        bool OnTxReady() override
+        {
+            ++this->numTxReady;
+            return true;
+        }
+
+        bool OnLowerLayerUp() override
+        {
+            this->isOnline = true;
+            return true;
+        }
+
+        bool OnLowerLayerDown() override
+        {
+            this->isOnline = false;
+            return true;
+        }
+
+        const Addresses route;
+        const bool respondToAnySource;
+
+        std::vector<Addresses> received;
+        size_t numTxReady = 0;
+        bool isOnline = false;
+    };
+
+    class IOHandlerTest
+    {
+    public:
+        IOHandlerTest()
+            : io(MockIO::Create()),
+              handler(std::make_shared<MockIOHandler>(log.logger)),
+              channel(std::make_shared<MockChannel>(io->GetExecutor()))
+        {
+        }
+
+        std::shared_ptr<MockSession> AddSession(const Addresses& route, bool respondToAnySource = false)
+        {
+            auto session = std::make_shared<MockSession>(route, respondToAnySource);
+            REQUIRE(this->handler->AddContext(session, route));
+            REQUIRE(this->handler->Enable(session));
+            return session;
+        }
+
+        // a frame as formatted by a session on this end of the channel
+        rseq_t Format(bool primary, const Addresses& route)
+        {
+            this->frames.emplace_back(new StaticBuffer<LPDU_MAX_FRAME_SIZE>());
+            auto dest = this->frames.back()->as_wseq();
+            return primary ? LinkFrame::FormatRequestLinkStatus(dest, true, route.source, route.destination, nullptr)
+                           : LinkFrame::FormatAck(dest, true, false, route.source, route.destination, nullptr);
+        }
+
+        // a frame sent by the remote end of the channel
+        void Receive(const Addresses& addresses)
+        {
+            StaticBuffer<LPDU_MAX_FRAME_SIZE> buffer;
+            auto dest = buffer.as_wseq();
+            this->channel->Receive(
+                LinkFrame::FormatRequestLinkStatus(dest, false, addresses.destination, addresses.source, nullptr));
+        }
+
+        bool IsUnknownRouteLogged()
+        {
+            bool found = false;
+            LogRecord record;
+            while (this->log.GetNextEntry(record))
+            {
+                found |= (record.message.find("unknown route") != std::string::npos);
+            }
+            return found;
+        }
+
+        MockLogHandler log;
+        std::shared_ptr<MockIO> io;
+        std::shared_ptr<MockIOHandler> handler;
+        std::shared_ptr<MockChannel> channel;
+
+    private:
+        std::vector<std::unique_ptr<StaticBuffer<LPDU_MAX_FRAME_SIZE>>> frames;
+    };
+} // namespace
+
+TEST_CASE(SUITE("secondary frames are written ahead of queued primary frames"))
+{
+    IOHandlerTest test;
+    auto a = test.AddSession(Addresses(10, 1));
+    auto b = test.AddSession(Addresses(20, 2));
+    test.handler->Open(test.channel);
+
+    const auto primaryA = test.Format(true, a->route);
+    const auto primaryB = test.Format(true, b->route);
+    const auto ack = test.Format(false, a->route);
+
+    test.handler->BeginTransmit(a, primaryA);
+    test.handler->BeginTransmit(b, primaryB);
+    test.handler->BeginTransmit(a, ack);
+
+    REQUIRE(test.channel->writes.size() == 1);
+    test.channel->CompleteWrite();
+    REQUIRE(a->numTxReady == 1);
+    test.channel->CompleteWrite();
+    REQUIRE(a->numTxReady == 2);
+    test.channel->CompleteWrite();
+    REQUIRE(b->numTxReady == 1);
+
+    REQUIRE(test.channel->writes
+            == std::vector<std::string>{HexConversions::to_hex(primaryA), HexConversions::to_hex(ack),
+                                        HexConversions::to_hex(primaryB)});
+
+    const auto stats = test.handler->Statistics().channel;
+    REQUIRE(stats.numPriorityTx == 1);
+    REQUIRE(stats.maxTxQueueDepth == 2);
+    REQUIRE(stats.numLinkFrameTx == 3);
+}
+
+TEST_CASE(SUITE("primary frames are written in the order they are queued"))
+{
+    IOHandlerTest test;
+    auto a = test.AddSession(Addresses(10, 1));
+    auto b = test.AddSession(Addresses(20, 2));
+    test.handler->Open(test.channel);
+
+    const auto primaryA = test.Format(true, a->route);
+    const auto primaryB = test.Format(true, b->route);
+    const auto ack = test.Format(false, b->route);
+
+    // nothing is queued behind the first write, so the acknowledgement doesn't overtake anything
+    test.handler->BeginTransmit(b, ack);
+    test.handler->BeginTransmit(b, primaryB);
+    test.handler->BeginTransmit(a, primaryA);
+
+    test.channel->CompleteWrite();
+    test.channel->CompleteWrite();
+    test.channel->CompleteWrite();
+
+    REQUIRE(test.channel->writes
+            == std::vector<std::string>{HexConversions::to_hex(ack), HexConversions::to_hex(primaryB),
+                                        HexConversions::to_hex(primaryA)});
+
+    const auto stats = test.handler->Statistics().channel;
+    REQUIRE(stats.numPriorityTx == 0);
+    REQUIRE(stats.maxTxQueueDepth == 2);
+}
+
+TEST_CASE(SUITE("frames are delivered to the session with the exact route"))
+{
+    IOHandlerTest test;
+    auto a = test.AddSession(Addresses(10, 1));
+    auto b = test.AddSession(Addresses(20, 2));
+    test.handler->Open(test.channel);
+
+    test.Receive(Addresses(10, 1));
+
+    REQUIRE(a->received == std::vector<Addresses>{Addresses(10, 1)});
+    REQUIRE(b->received.empty());
+    REQUIRE_FALSE(test.IsUnknownRouteLogged());
+}
+
+TEST_CASE(SUITE("broadcasts are delivered to every enabled session"))
+{
+    IOHandlerTest test;
+    auto a = test.AddSession(Addresses(10, 1));
+    auto b = test.AddSession(Addresses(20, 2));
+    auto c = std::make_shared<MockSession>(Addresses(30, 3));
+    REQUIRE(test.handler->AddContext(c, c->route));
+    test.handler->Open(test.channel);
+
+    const Addresses broadcast(10, LinkBroadcastAddress::ShallConfirm);
+    test.Receive(broadcast);
+
+    REQUIRE(a->received == std::vector<Addresses>{broadcast});
+    REQUIRE(b->received == std::vector<Addresses>{broadcast});
+    REQUIRE(c->received.empty());
+}
+
+TEST_CASE(SUITE("frames for an unknown destination reach every enabled session and are reported"))
+{
+    IOHandlerTest test;
+    auto a = test.AddSession(Addresses(10, 1));
+    auto b = test.AddSession(Addresses(20, 2));
+    test.handler->Open(test.channel);
+    test.log.ClearLog();
+
+    test.Receive(Addresses(10, 3));
+
+    REQUIRE(a->received == std::vector<Addresses>{Addresses(10, 3)});
+    REQUIRE(b->received == std::vector<Addresses>{Addresses(10, 3)});
+    REQUIRE(test.IsUnknownRouteLogged());
+}
+
+TEST_CASE(SUITE("sessions that respond to any source share a destination with other sessions"))
+{
+    IOHandlerTest test;
+    auto a = test.AddSession(Addresses(10, 1));
+    auto any = test.AddSession(Addresses(30, 1), true);
+    auto b = test.AddSession(Addresses(20, 2));
+    test.handler->Open(test.channel);
+    test.log.ClearLog();
+
+    // only the session that responds to any source accepts this one, but the route is still known
+    test.Receive(Addresses(40, 1));
+    REQUIRE(a->received == std::vector<Addresses>{Addresses(40, 1)});
+    REQUIRE(any->received == std::vector<Addresses>{Addresses(40, 1)});
+    REQUIRE(b->received.empty());
+    REQUIRE_FALSE(test.IsUnknownRouteLogged());
+
+    test.Receive(Addresses(10, 1));
+    REQUIRE(a->received.size() == 2);
+    REQUIRE(any->received.size() == 2);
+    REQUIRE(b->received.empty());
+    REQUIRE_FALSE(test.IsUnknownRouteLogged());
+}
+
+TEST_CASE(SUITE("routes follow sessions that are enabled, disabled and removed"))
+{
+    IOHandlerTest test;
+    auto a = test.AddSession(Addresses(10, 1));
+    auto b = test.AddSession(Addresses(20, 2));
+    auto c = test.AddSession(Addresses(30, 2));
+    test.handler->Open(test.channel);
+    test.log.ClearLog();
+
+    // a disabled session no longer receives the frames for its route
+    REQUIRE(test.handler->Disable(b));
+    test.Receive(Addresses(20, 2));
+    REQUIRE(b->received.empty());
+    REQUIRE(c->received == std::vector<Addresses>{Addresses(20, 2)});
+    REQUIRE(test.IsUnknownRouteLogged());
+
+    // removing a session shifts the others, which must still be found by destination
+    REQUIRE(test.handler->Remove(a));
+    test.Receive(Addresses(30, 2));
+    REQUIRE(a->received.empty());
+    REQUIRE(b->received.empty());
+    REQUIRE(c->received.size() == 2);
+    REQUIRE_FALSE(test.IsUnknownRouteLogged());
+
+    REQUIRE(test.handler->Enable(b));
+    test.Receive(Addresses(20, 2));
+    REQUIRE(b->received == std::vector<Addresses>{Addresses(20, 2)});
+    REQUIRE(c->received.size() == 3);
+    REQUIRE_FALSE(test.IsUnknownRouteLogged());
+
+    // the removed session's destination is now unknown
+    test.Receive(Addresses(10, 1));
+    REQUIRE(a->received.empty());
+    REQUIRE(b->received.size() == 2);
+    REQUIRE(c->received.size() == 4);
+    REQUIRE(test.IsUnknownRouteLogged());
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <link/LinkFrame.h>
+#include <link/LinkLayerConstants.h>
+
+#include <app/parsing/APDUHeaderParser.h>
+#include <app/parsing/APDUParser.h>
+#include <catch.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace opendnp3;
+using namespace ser4cpp;
+
+#define SUITE(name) "APDUParsingBenchmarks - " name
+
+namespace
+{
+    class NullAPDUHandler final : public IAPDUHandler
+    {
+    public:
+        bool IsAllowed(uint32_t headerCount, GroupVariation gv, QualifierCode qc) final
+        {
+            return true;
+        }
+    };
+
+    // extract the object data of every single segment APDU in the link frames of the fuzzing corpus
+    std::vector<std::vector<uint8_t>> LoadCorpusObjects()
+    {
+        std::vector<std::vector<uint8_t>> objects;
+
+        std::ifstream list(DNP3_FUZZ_CORPUS_LIST);
+        std::string path;
+        while (std::getline(list, path))
+        {
+            std::ifstream file(path, std::ios::binary);
+            const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+            size_t pos = 0;
+            while ((bytes.size() - pos) >= LPDU_HEADER_SIZE && bytes[pos] == 0x05 && bytes[pos + 1] == 0x64
+                   && bytes[pos + 2] >= LPDU_MIN_LENGTH)
+            {
+                const size_t user_data_size = bytes[pos + 2] - LPDU_MIN_LENGTH;
+                const auto frame_size = LinkFrame::CalcFrameSize(user_data_size);
+                if (pos + frame_size > bytes.size())
+                {
+                    break;
+                }
+
+                std::vector<uint8_t> user_data(user_data_size);
+                const auto valid = LinkFrame::ValidateAndReadUserData(bytes.data() + pos + LPDU_HEADER_SIZE,
+                                                                      user_data.data(), user_data_size);
+                pos += frame_size;
+
+                // transport header w/ FIR and FIN, then the application header
+                if (!valid || user_data.size() < 3 || (user_data[0] & 0xC0) != 0xC0)
+                {
+                    continue;
+                }
+
+                const auto function = user_data[2];
+                const auto is_response = function == 0x81 || function == 0x82 || function == 0x83;
+                const auto header_size = is_response ? APDUHeader::RESPONSE_SIZE : APDUHeader::REQUEST_SIZE;
+                if (user_data.size() > 1 + header_size)
+                {
+                    objects.emplace_back(user_data.begin() + 1 + header_size, user_data.end());
+                }
+            }
+        }
+
+        return objects;
+    }
+} // namespace
+
+TEST_CASE(SUITE("indexed parsing against two full passes"))
+{
+    const int num_iterations = 10000;
+
+    // only APDUs that pass validation are handled a 2nd time
+    std::vector<std::vector<uint8_t>> corpus;
+    for (auto& objects : LoadCorpusObjects())
+    {
+        if (APDUParser::ParseAndLogAll(rseq_t(objects.data(), objects.size()), nullptr) == ParseResult::OK)
+        {
+            corpus.push_back(std::move(objects));
+        }
+    }
+    REQUIRE_FALSE(corpus.empty());
+
+    const auto measure = [&](const char* name, auto parse) {
+        NullAPDUHandler handler;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < num_iterations; ++i)
+        {
+            for (const auto& objects : corpus)
+            {
+                const rseq_t buffer(objects.data(), objects.size());
+                parse(buffer, handler);
+            }
+        }
+        const auto elapsed
+            = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << name << ": " << corpus.size() * num_iterations << " APDUs in " << elapsed.count() << " us"
+                  << std::endl;
+    };
+
+    measure("two passes", [](const rseq_t& buffer, IAPDUHandler& handler) {
+        const auto result = APDUParser::ParseSinglePass(buffer, nullptr, nullptr, &handler, ParserSettings::Default());
+        return (result == ParseResult::OK)
+            ? APDUParser::ParseSinglePass(buffer, nullptr, &handler, nullptr, ParserSettings::Default())
+            : result;
+    });
+
+    measure("indexed", [](const rseq_t& buffer, IAPDUHandler& handler) {
+        return APDUParser::Parse(buffer, handler, nullptr, ParserSettings::Default());
+    });
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <opendnp3/master/BatchSOEHandler.h>
+
+#include <catch.hpp>
+#include <master/MeasurementHandler.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "BatchSOEHandlerBenchmarks - " name
+
+TEST_CASE(SUITE("batches against visiting each value"))
+{
+    const int num_iterations = 10000;
+    const uint16_t num_points = 1000;
+
+    // g30v1 2 byte start/stop 0 -> 999
+    std::vector<uint8_t> objects = {0x1E, 0x01, 0x01, 0x00, 0x00, 0xE7, 0x03};
+    for (uint16_t i = 0; i < num_points; ++i)
+    {
+        objects.insert(objects.end(), {0x01, static_cast<uint8_t>(i), static_cast<uint8_t>(i >> 8), 0x00, 0x00});
+    }
+    const ser4cpp::rseq_t buffer(objects.data(), objects.size());
+
+    const auto measure = [&](const char* name, ISOEHandler& handler, const double& sum) {
+        auto logger = Logger::empty();
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < num_iterations; ++i)
+        {
+            MeasurementHandler::ProcessMeasurements(ResponseInfo(true, true, true), buffer, logger, &handler);
+        }
+        const auto elapsed
+            = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << name << ": " << num_iterations * num_points << " analogs in " << elapsed.count() << " us"
+                  << " (sum " << sum << ")" << std::endl;
+    };
+
+    // copy every point into the columns of a historian one at a time
+    class VisitingHandler final : public ISOEHandler
+    {
+    public:
+        void BeginFragment(const ResponseInfo& info) override {}
+        void EndFragment(const ResponseInfo& info) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<Binary>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<DoubleBitBinary>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<Analog>>& values) override
+        {
+            values.ForeachItem([this](const Indexed<Analog>& item) {
+                this->sum += item.value.value;
+                this->indices.push_back(item.index);
+            });
+            this->indices.clear();
+        }
+        void Process(const HeaderInfo& info, const ICollection<Indexed<Counter>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<FrozenCounter>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryOutputStatus>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogOutputStatus>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override {}
+
+        double sum = 0;
+        std::vector<uint16_t> indices;
+    };
+
+    class SummingBatchHandler final : public BatchSOEHandler
+    {
+    public:
+        void BeginFragment(const ResponseInfo& info) override {}
+        void EndFragment(const ResponseInfo& info) override {}
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<Binary>& values) override {}
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<DoubleBitBinary>& values) override {}
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<Analog>& values) override
+        {
+            for (size_t i = 0; i < values.count; ++i)
+            {
+                this->sum += values.values[i];
+            }
+            this->indices.assign(values.indices, values.indices + values.count);
+            this->indices.clear();
+        }
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<Counter>& values) override {}
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<FrozenCounter>& values) override {}
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<BinaryOutputStatus>& values) override {}
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<AnalogOutputStatus>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override {}
+
+        double sum = 0;
+        std::vector<uint16_t> indices;
+    };
+
+    VisitingHandler visiting;
+    measure("visitor per value", visiting, visiting.sum);
+
+    SummingBatchHandler batching;
+    measure("batch", batching, batching.sum);
+}
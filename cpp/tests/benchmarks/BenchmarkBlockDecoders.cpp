@@ -0,0 +1,83 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <app/parsing/BlockCollections.h>
+#include <app/parsing/BlockDecoders.h>
+#include <app/parsing/BufferedCollection.h>
+#include <catch.hpp>
+#include <gen/objects/Group30.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "BlockDecodersBenchmarks - " name
+
+namespace
+{
+    std::vector<uint8_t> RandomBytes(std::mt19937& gen, size_t count)
+    {
+        std::uniform_int_distribution<int> dist(0, 255);
+        std::vector<uint8_t> bytes(count);
+        for (auto& byte : bytes)
+        {
+            byte = static_cast<uint8_t>(dist(gen));
+        }
+        return bytes;
+    }
+} // namespace
+
+TEST_CASE(SUITE("block decoding against the generated readers"))
+{
+    const int num_iterations = 10000;
+    const uint16_t num_points = 1000;
+
+    std::mt19937 gen(23);
+    const auto bytes = RandomBytes(gen, num_points * Group30Var1::Size());
+    const ser4cpp::rseq_t buffer(bytes.data(), bytes.size());
+    const auto range = Range::From(0, num_points - 1);
+
+    std::vector<Indexed<Analog>> values(num_points);
+
+    const auto measure = [&](const char* name, const ICollection<Indexed<Analog>>& collection) {
+        double sum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < num_iterations; ++i)
+        {
+            collection.CopyTo(values.data());
+            sum += values[i % num_points].value.value;
+        }
+        const auto elapsed
+            = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << name << ": " << num_iterations * num_points << " g30v1 in " << elapsed.count() << " us"
+                  << " (sum " << sum << ")" << std::endl;
+    };
+
+    auto read = [range](ser4cpp::rseq_t& buffer, uint32_t pos) {
+        Analog target;
+        Group30Var1::ReadTarget(buffer, target);
+        return WithIndex(target, range.start + pos);
+    };
+    measure("generated reader", CreateBufferedCollection<Indexed<Analog>>(buffer, num_points, read));
+
+    measure("block decoder", RangeBlockCollection<FlagsAndValueBlockDecoder<Group30Var1>>(buffer, range));
+}
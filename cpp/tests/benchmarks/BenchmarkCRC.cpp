@@ -0,0 +1,118 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <catch.hpp>
+#include <link/CRC.h>
+#include <link/LinkLayerConstants.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "CRCBenchmarks - " name
+
+namespace
+{
+    std::vector<uint8_t> random_bytes(std::mt19937& gen, size_t length)
+    {
+        std::uniform_int_distribution<int> dist(0, 255);
+        std::vector<uint8_t> bytes(length);
+        for (auto& byte : bytes)
+        {
+            byte = static_cast<uint8_t>(dist(gen));
+        }
+        return bytes;
+    }
+
+    // interleave a CRC after every 16 byte block the same way a link frame body is formatted
+    std::vector<uint8_t> format_body(const std::vector<uint8_t>& user_data)
+    {
+        std::vector<uint8_t> body;
+        for (size_t pos = 0; pos < user_data.size(); pos += LPDU_DATA_BLOCK_SIZE)
+        {
+            const auto num = std::min<size_t>(LPDU_DATA_BLOCK_SIZE, user_data.size() - pos);
+            const auto start = body.size();
+            body.insert(body.end(), user_data.begin() + pos, user_data.begin() + pos + num);
+            body.resize(body.size() + LPDU_CRC_SIZE);
+            CRC::AddCrc(body.data() + start, num);
+        }
+        return body;
+    }
+} // namespace
+
+TEST_CASE(SUITE("sliced CRC against the bytewise CRC"))
+{
+    const int num_iterations = 100000;
+
+    std::mt19937 gen(23);
+    const auto user_data = random_bytes(gen, LPDU_MAX_USER_DATA_SIZE);
+    const auto body = format_body(user_data);
+
+    const auto measure = [&](const char* name, auto validate) {
+        uint64_t checksum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < num_iterations; ++i)
+        {
+            checksum += validate(body.data(), user_data.size());
+        }
+        const auto elapsed
+            = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        const auto bytes = static_cast<uint64_t>(user_data.size()) * num_iterations;
+        std::cout << name << ": " << bytes << " bytes in " << elapsed.count() << " us == "
+                  << (elapsed.count() ? (bytes / static_cast<uint64_t>(elapsed.count())) : 0) << " bytes/us"
+                  << " (checksum " << checksum << ")" << std::endl;
+    };
+
+    measure("bytewise per block", [](const uint8_t* data, size_t length) {
+        while (length > 0)
+        {
+            const auto num = std::min<size_t>(LPDU_DATA_BLOCK_SIZE, length);
+            const uint16_t crc = CRC::CalcCrcBytewise(data, num);
+            if ((data[num] | (data[num + 1] << 8)) != crc)
+            {
+                return false;
+            }
+            data += num + LPDU_CRC_SIZE;
+            length -= num;
+        }
+        return true;
+    });
+
+    measure("sliced per block", [](const uint8_t* data, size_t length) {
+        while (length > 0)
+        {
+            const auto num = std::min<size_t>(LPDU_DATA_BLOCK_SIZE, length);
+            if (!CRC::IsCorrectCRC(data, num))
+            {
+                return false;
+            }
+            data += num + LPDU_CRC_SIZE;
+            length -= num;
+        }
+        return true;
+    });
+
+    measure("AreBlockCRCsCorrect", [](const uint8_t* data, size_t length) {
+        return CRC::AreBlockCRCsCorrect(data, length);
+    });
+}
@@ -17,38 +17,34 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <exe4cpp/Timer.h>
+#include <exe4cpp/TimerWheel.h>
 
-#ifndef OPENDNP3_EVENTRECORD_H
-#define OPENDNP3_EVENTRECORD_H
+#include <catch.hpp>
 
-#include "EventState.h"
-#include "IEventType.h"
+#include <chrono>
+#include <iostream>
 
-#include "opendnp3/app/EventType.h"
+using namespace exe4cpp;
+using namespace std::chrono;
 
-namespace opendnp3
-{
+#define SUITE(name) "TimerWheelBenchmarks - " name
 
-/**
- * Generic event information with an opaque pointer to
- * the specific event details
- */
-class EventRecord
+TEST_CASE(SUITE("re-arming a timer"))
 {
-
-public:
-    EventRecord() = default;
-    EventRecord(uint16_t index, EventClass clazz);
-
-    uint16_t index = 0;
-    EventClass clazz = EventClass::EC1;
-    EventState state = EventState::unselected;
-
-    // always set as a unit
-    IEventType* type = nullptr;
-    void* storage_node = nullptr;
-};
-
-} // namespace opendnp3
-
-#endif
+    const auto now = steady_clock::now();
+    TimerWheel wheel(now, [](const steady_time_t&) {}, []() {});
+    const size_t ITERATIONS = 1000000;
+
+    // the restart pattern of a response timeout, canceled and started on every message
+    Timer timer;
+    const auto start = steady_clock::now();
+    for (size_t i = 0; i < ITERATIONS; ++i)
+    {
+        timer.cancel();
+        timer = Timer(wheel.start(now + seconds(5), now, []() {}));
+    }
+    const auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - start);
+
+    std::cout << "wheel re-arm: " << (elapsed.count() / ITERATIONS) << " ns" << std::endl;
+}
@@ -17,18 +17,5 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-
-#include "EventRecord.h"
-
-namespace opendnp3
-{
-
-EventRecord::EventRecord(uint16_t index, EventClass clazz)
-    :
-
-      index(index),
-      clazz(clazz)
-{
-}
-
-} // namespace opendnp3
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
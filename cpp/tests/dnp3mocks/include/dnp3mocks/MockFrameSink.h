@@ -29,6 +29,7 @@
 
 #include <functional>
 #include <queue>
+#include <vector>
 
 class MockFrameSink : public opendnp3::ILinkSession
 {
@@ -42,6 +43,9 @@ public:
 
     bool OnFrame(const opendnp3::LinkHeaderFields& header, const ser4cpp::rseq_t& userdata) final;
 
+    // provides userDataBuffer to the parser if it is not empty
+    ser4cpp::wseq_t GetUserDataBuffer(const opendnp3::LinkHeaderFields& header, size_t length) final;
+
     void Reset();
 
     bool CheckLast(opendnp3::LinkFunction func, bool aIsMaster, uint16_t aDest, uint16_t aSrc);
@@ -55,6 +59,10 @@ public:
 
     bool mLowerOnline;
 
+    // destination for de-CRC'd user data, and where the user data of the last frame was located
+    std::vector<uint8_t> userDataBuffer;
+    const uint8_t* m_last_userdata = nullptr;
+
     // Add a function to execute the next time a frame is received
     // This allows us to test re-entrant behaviors
     void AddAction(const std::function<void()>& fun);
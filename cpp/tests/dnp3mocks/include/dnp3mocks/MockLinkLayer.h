@@ -36,7 +36,11 @@ public:
     {
         while (segments.HasValue())
         {
-            sends.push_back(ser4cpp::HexConversions::to_hex(segments.GetSegment()));
+            const auto payload = segments.GetPayload();
+            std::vector<uint8_t> segment(1, segments.GetHeader());
+            segment.insert(segment.end(), static_cast<const uint8_t*>(payload),
+                           static_cast<const uint8_t*>(payload) + payload.length());
+            sends.push_back(ser4cpp::HexConversions::to_hex(segment.data(), segment.size(), true));
             segments.Advance();
         }
 
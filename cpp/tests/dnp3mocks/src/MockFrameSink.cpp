@@ -68,6 +68,7 @@ bool MockFrameSink::OnFrame(const LinkHeaderFields& header, const rseq_t& userda
     ++m_num_frames;
 
     this->m_last_header = header;
+    this->m_last_userdata = userdata;
 
     if (userdata.is_not_empty())
     {
@@ -77,6 +78,11 @@ bool MockFrameSink::OnFrame(const LinkHeaderFields& header, const rseq_t& userda
     return true;
 }
 
+wseq_t MockFrameSink::GetUserDataBuffer(const LinkHeaderFields& /*header*/, size_t /*length*/)
+{
+    return wseq_t(this->userDataBuffer.data(), this->userDataBuffer.size());
+}
+
 void MockFrameSink::AddAction(const std::function<void()>& fun)
 {
     m_actions.push_back(fun);
@@ -31,6 +31,7 @@
 
 #include <catch.hpp>
 
+#include <atomic>
 #include <iostream>
 #include <thread>
 
@@ -126,3 +127,33 @@ TEST_CASE(SUITE("ManualChannelShutdown"))
         channels.server->Shutdown();
     }
 }
+
+TEST_CASE(SUITE("ConstructionDestructionWithContextPerThread"))
+{
+    const auto noop = [](uint32_t) {};
+
+    for (int i = 0; i < ITERATIONS; ++i)
+    {
+        DNP3Manager manager(4, nullptr, noop, noop, IOContextMode::PerThread);
+        Components components(manager);
+        components.Enable();
+    }
+}
+
+TEST_CASE(SUITE("ContextPerThreadReportsEachThreadIndex"))
+{
+    std::atomic<uint32_t> started[4] = {};
+    std::atomic<uint32_t> exited[4] = {};
+
+    {
+        DNP3Manager manager(
+            4, nullptr, [&](uint32_t index) { ++started[index]; }, [&](uint32_t index) { ++exited[index]; },
+            IOContextMode::PerThread);
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        REQUIRE(started[i] == 1);
+        REQUIRE(exited[i] == 1);
+    }
+}
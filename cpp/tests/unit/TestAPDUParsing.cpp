@@ -459,4 +459,46 @@ TEST_CASE(SUITE("can parse 0x17 and 0x28 qualifers as collection of indices"))
     TestComplex("01 02 17 02 2A FF", ParseResult::OK, 1, validator, ParserSettings::NoContents());
     // g1v1 0x28 (count == 2) addresses == {42, 255}
     TestComplex("01 02 28 02 00 2A 00 FF 00", ParseResult::OK, 1, validator, ParserSettings::NoContents());
-}
\ No newline at end of file
+}
+
+std::string RepeatHex(const std::string& hex, size_t count)
+{
+    std::string ret;
+    for (size_t i = 0; i < count; ++i)
+    {
+        ret += hex + " ";
+    }
+    return ret;
+}
+
+TEST_CASE(SUITE("handles every header when the header index is full"))
+{
+    // g1v2 1 byte start/stop 0 -> 0, online
+    const std::string header = "01 02 00 00 00 01";
+
+    for (auto num : {HeaderIndex::max_headers, HeaderIndex::max_headers + 1, 2 * HeaderIndex::max_headers})
+    {
+        TestComplex(RepeatHex(header, num), ParseResult::OK, num, [num](MockApduHeaderHandler& mock) {
+            REQUIRE(num == mock.staticBinaries.size());
+            REQUIRE(num - 1 == mock.records.back().headerIndex);
+        });
+    }
+}
+
+TEST_CASE(SUITE("indexed headers are handled in order with every qualifier"))
+{
+    // class 1 all objects, g50v1 count of 1, g1v2 range 3 -> 4, g2v1 count 1 index 5
+    TestComplex("3C 02 06 32 01 07 01 00 00 00 00 00 00 01 02 00 03 04 81 01 02 01 17 01 05 81", ParseResult::OK, 4,
+                [](MockApduHeaderHandler& mock) {
+                    REQUIRE((mock.records[0].enumeration == GroupVariation::Group60Var2));
+                    REQUIRE((mock.records[1].enumeration == GroupVariation::Group50Var1));
+                    REQUIRE((mock.records[2].enumeration == GroupVariation::Group1Var2));
+                    REQUIRE((mock.records[3].enumeration == GroupVariation::Group2Var1));
+
+                    REQUIRE(2 == mock.staticBinaries.size());
+                    REQUIRE(3 == mock.staticBinaries[0].index);
+                    REQUIRE(4 == mock.staticBinaries[1].index);
+                    REQUIRE(1 == mock.eventBinaries.size());
+                    REQUIRE(5 == mock.eventBinaries[0].index);
+                });
+}
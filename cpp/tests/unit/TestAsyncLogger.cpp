@@ -0,0 +1,176 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <opendnp3/AsyncLogger.h>
+#include <opendnp3/logging/BinaryLogReader.h>
+
+#include <catch.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "AsyncLoggerTestSuite - " name
+
+namespace
+{
+    const char* const LOG_PATH = "async-logger-test.bin";
+
+    std::vector<LogRecord> ReadLog()
+    {
+        std::ifstream file(LOG_PATH, std::ios::binary);
+        BinaryLogReader reader(file);
+        REQUIRE(reader.IsValid());
+
+        std::vector<LogRecord> records;
+        LogRecord record;
+        while (reader.Read(record))
+        {
+            records.push_back(record);
+        }
+        return records;
+    }
+} // namespace
+
+TEST_CASE(SUITE("BinaryLogRoundTrips"))
+{
+    {
+        auto logger = AsyncLogger::CreateBinary(LOG_PATH);
+        logger->log(ModuleId(7), "outstation", flags::WARN, "file.cpp(10)", "hello");
+        logger->log(ModuleId(8), "master", flags::APP_HEADER_RX, "file.cpp(20)", "world");
+        logger->Flush();
+
+        REQUIRE(logger->NumLogged() == 2);
+        REQUIRE(logger->NumDropped() == 0);
+    }
+
+    const auto records = ReadLog();
+    REQUIRE(records.size() == 2);
+
+    REQUIRE(records[0].module.value == 7);
+    REQUIRE(records[0].level == flags::WARN);
+    REQUIRE(records[0].id == "outstation");
+    REQUIRE(records[0].location == "file.cpp(10)");
+    REQUIRE(records[0].message == "hello");
+    REQUIRE(records[0].timestamp > 0);
+
+    REQUIRE(records[1].module.value == 8);
+    REQUIRE(records[1].level == flags::APP_HEADER_RX);
+    REQUIRE(records[1].message == "world");
+
+    std::ostringstream text;
+    records[0].Print(text, true);
+    REQUIRE(text.str().find("outstation - file.cpp(10) - hello\n") != std::string::npos);
+
+    std::remove(LOG_PATH);
+}
+
+TEST_CASE(SUITE("EachThreadKeepsItsOwnOrder"))
+{
+    const int NUM_THREADS = 4;
+    const int NUM_MESSAGES = 200;
+
+    {
+        AsyncLoggerConfig config;
+        config.recordsPerThread = NUM_MESSAGES;
+        auto logger = AsyncLogger::CreateBinary(LOG_PATH, config);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < NUM_THREADS; ++t)
+        {
+            threads.emplace_back([&logger, t]() {
+                const auto id = std::to_string(t);
+                for (int i = 0; i < NUM_MESSAGES; ++i)
+                {
+                    logger->log(ModuleId(), id.c_str(), flags::INFO, "", std::to_string(i).c_str());
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    std::vector<int> next(NUM_THREADS, 0);
+    for (const auto& record : ReadLog())
+    {
+        auto& expected = next[std::stoi(record.id)];
+        REQUIRE(record.message == std::to_string(expected));
+        ++expected;
+    }
+
+    for (auto count : next)
+    {
+        REQUIRE(count == NUM_MESSAGES);
+    }
+
+    std::remove(LOG_PATH);
+}
+
+TEST_CASE(SUITE("FullRingDropsAndReportsMessages"))
+{
+    {
+        AsyncLoggerConfig config;
+        config.recordsPerThread = 3; // rounded up to 4
+        config.flushPeriod = TimeDuration::Minutes(10);
+        auto logger = AsyncLogger::CreateBinary(LOG_PATH, config);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            logger->log(ModuleId(), "id", flags::INFO, "", "message");
+        }
+
+        REQUIRE(logger->NumDropped() == 6);
+
+        logger->Flush();
+        REQUIRE(logger->NumLogged() == 4);
+    }
+
+    const auto records = ReadLog();
+    REQUIRE(records.size() == 5);
+    REQUIRE(records[4].level == flags::WARN);
+    REQUIRE(records[4].message == "6 messages dropped, ring full");
+
+    std::remove(LOG_PATH);
+}
+
+TEST_CASE(SUITE("LongStringsAreTruncated"))
+{
+    const std::string longMessage(1000, 'x');
+
+    {
+        auto logger = AsyncLogger::CreateBinary(LOG_PATH);
+        logger->log(ModuleId(), std::string(100, 'i').c_str(), flags::INFO, "", longMessage.c_str());
+    }
+
+    const auto records = ReadLog();
+    REQUIRE(records.size() == 1);
+    REQUIRE(records[0].id.size() < 100);
+    REQUIRE(records[0].message.size() < longMessage.size());
+    REQUIRE(longMessage.compare(0, records[0].message.size(), records[0].message) == 0);
+
+    std::remove(LOG_PATH);
+}
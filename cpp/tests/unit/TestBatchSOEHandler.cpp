@@ -0,0 +1,133 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/BufferHelpers.h"
+
+#include "dnp3mocks/MockLogHandler.h"
+
+#include <opendnp3/master/BatchSOEHandler.h>
+
+#include <catch.hpp>
+#include <master/MeasurementHandler.h>
+
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "BatchSOEHandlerTestSuite - " name
+
+namespace
+{
+    class RecordingBatchHandler final : public BatchSOEHandler
+    {
+    public:
+        void BeginFragment(const ResponseInfo& info) override {}
+        void EndFragment(const ResponseInfo& info) override {}
+
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<Binary>& values) override
+        {
+            Record(values, this->binaries);
+        }
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<DoubleBitBinary>& values) override {}
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<Analog>& values) override
+        {
+            Record(values, this->analogs);
+        }
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<Counter>& values) override {}
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<FrozenCounter>& values) override {}
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<BinaryOutputStatus>& values) override {}
+        void ProcessBatch(const HeaderInfo& info, const MeasurementBatch<AnalogOutputStatus>& values) override {}
+
+        void Process(const HeaderInfo& info, const ICollection<Indexed<OctetString>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<TimeAndInterval>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<BinaryCommandEvent>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<Indexed<AnalogCommandEvent>>& values) override {}
+        void Process(const HeaderInfo& info, const ICollection<DNPTime>& values) override {}
+
+        size_t numBatches = 0;
+        std::vector<Indexed<Binary>> binaries;
+        std::vector<Indexed<Analog>> analogs;
+
+    private:
+        template<class T> void Record(const MeasurementBatch<T>& batch, std::vector<Indexed<T>>& records)
+        {
+            ++this->numBatches;
+            for (size_t i = 0; i < batch.count; ++i)
+            {
+                records.push_back(WithIndex(batch.Get(i), batch.indices[i]));
+            }
+        }
+    };
+
+    ParseResult Process(const std::string& objects, ISOEHandler& handler)
+    {
+        MockLogHandler log;
+        HexSequence hex(objects);
+        return MeasurementHandler::ProcessMeasurements(ResponseInfo(true, true, true), hex.ToRSeq(), log.logger,
+                                                       &handler);
+    }
+} // namespace
+
+TEST_CASE(SUITE("delivers a range of analogs as a single batch"))
+{
+    RecordingBatchHandler handler;
+
+    // g30v1 1 byte start/stop 2 -> 4
+    REQUIRE(Process("1E 01 00 02 04 01 0A 00 00 00 01 0B 00 00 00 21 0C 00 00 00", handler) == ParseResult::OK);
+
+    REQUIRE(handler.numBatches == 1);
+    REQUIRE(handler.analogs.size() == 3);
+    for (uint16_t i = 0; i < 3; ++i)
+    {
+        REQUIRE(handler.analogs[i].index == i + 2);
+        REQUIRE(handler.analogs[i].value.value == 10 + i);
+    }
+    REQUIRE(handler.analogs[0].value.flags.value == 0x01);
+    REQUIRE(handler.analogs[2].value.flags.value == 0x21);
+}
+
+TEST_CASE(SUITE("applies the common time of occurrence to the times of a batch"))
+{
+    RecordingBatchHandler handler;
+
+    // g51v1 CTO == 7, g2v3 count of 1 index 8, relative time 1
+    REQUIRE(Process("33 01 07 01 07 00 00 00 00 00 02 03 17 01 08 81 01 00", handler) == ParseResult::OK);
+
+    REQUIRE(handler.binaries.size() == 1);
+    REQUIRE(handler.binaries[0].index == 8);
+    REQUIRE(handler.binaries[0].value.value);
+    REQUIRE(handler.binaries[0].value.time.value == 8);
+    REQUIRE(handler.binaries[0].value.time.quality == TimestampQuality::SYNCHRONIZED);
+}
+
+TEST_CASE(SUITE("reuses its columns for headers of different sizes"))
+{
+    RecordingBatchHandler handler;
+
+    // g1v2 1 byte start/stop 0 -> 2, then g1v2 1 byte start/stop 5 -> 5
+    REQUIRE(Process("01 02 00 00 02 81 01 81 01 02 00 05 05 01", handler) == ParseResult::OK);
+
+    REQUIRE(handler.numBatches == 2);
+    REQUIRE(handler.binaries.size() == 4);
+    REQUIRE(handler.binaries[1].index == 1);
+    REQUIRE_FALSE(handler.binaries[1].value.value);
+    REQUIRE(handler.binaries[3].index == 5);
+    REQUIRE_FALSE(handler.binaries[3].value.value);
+    REQUIRE(handler.binaries[3].value.flags.value == 0x01);
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <app/parsing/BlockCollections.h>
+#include <app/parsing/BlockDecoders.h>
+#include <app/parsing/BufferedCollection.h>
+#include <catch.hpp>
+#include <gen/objects/Group1.h>
+#include <gen/objects/Group10.h>
+#include <gen/objects/Group20.h>
+#include <gen/objects/Group30.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "BlockDecodersTestSuite - " name
+
+namespace
+{
+    std::vector<uint8_t> RandomBytes(std::mt19937& gen, size_t count)
+    {
+        std::uniform_int_distribution<int> dist(0, 255);
+        std::vector<uint8_t> bytes(count);
+        for (auto& byte : bytes)
+        {
+            byte = static_cast<uint8_t>(dist(gen));
+        }
+        return bytes;
+    }
+
+    // compares the bits of the values so that NaNs decoded from random floats compare equal
+    template<class T> bool SameMeasurement(const T& lhs, const T& rhs)
+    {
+        return (lhs.flags.value == rhs.flags.value) && (lhs.time == rhs.time)
+            && (std::memcmp(&lhs.value, &rhs.value, sizeof(lhs.value)) == 0);
+    }
+
+    // decode random objects w/ both the generated reader and the block decoder
+    template<class Descriptor, class Decoder> void TestDecoderMatchesDescriptor()
+    {
+        std::mt19937 gen(42);
+
+        REQUIRE(Decoder::Size() == Descriptor::Size());
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto bytes = RandomBytes(gen, Descriptor::Size());
+
+            ser4cpp::rseq_t buffer(bytes.data(), bytes.size());
+            typename Descriptor::Target expected;
+            REQUIRE(Descriptor::ReadTarget(buffer, expected));
+
+            REQUIRE(SameMeasurement(expected, Decoder::Decode(bytes.data())));
+        }
+    }
+} // namespace
+
+TEST_CASE(SUITE("flags decoders match the generated readers"))
+{
+    TestDecoderMatchesDescriptor<Group1Var2, FlagsBlockDecoder<Group1Var2>>();
+    TestDecoderMatchesDescriptor<Group10Var2, FlagsBlockDecoder<Group10Var2>>();
+}
+
+TEST_CASE(SUITE("flags and value decoders match the generated readers"))
+{
+    TestDecoderMatchesDescriptor<Group20Var1, FlagsAndValueBlockDecoder<Group20Var1>>();
+    TestDecoderMatchesDescriptor<Group20Var2, FlagsAndValueBlockDecoder<Group20Var2>>();
+    TestDecoderMatchesDescriptor<Group30Var1, FlagsAndValueBlockDecoder<Group30Var1>>();
+    TestDecoderMatchesDescriptor<Group30Var2, FlagsAndValueBlockDecoder<Group30Var2>>();
+    TestDecoderMatchesDescriptor<Group30Var5, FlagsAndValueBlockDecoder<Group30Var5>>();
+}
+
+TEST_CASE(SUITE("range block collection indexes values from the start of the range"))
+{
+    // g30v1 w/ values 10, 11, 12
+    const uint8_t bytes[] = {0x01, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x00, 0x21, 0x0C, 0x00, 0x00, 0x00};
+    RangeBlockCollection<FlagsAndValueBlockDecoder<Group30Var1>> collection(ser4cpp::rseq_t(bytes, sizeof(bytes)),
+                                                                            Range::From(7, 9));
+
+    std::vector<Indexed<Analog>> visited;
+    collection.ForeachItem([&](const Indexed<Analog>& value) { visited.push_back(value); });
+
+    Indexed<Analog> copied[3];
+    collection.CopyTo(copied);
+
+    REQUIRE(collection.Count() == 3);
+    REQUIRE(visited.size() == 3);
+    for (uint16_t i = 0; i < 3; ++i)
+    {
+        REQUIRE(visited[i].index == 7 + i);
+        REQUIRE(visited[i].value.value == 10 + i);
+        REQUIRE(copied[i].index == visited[i].index);
+        REQUIRE(SameMeasurement(copied[i].value, visited[i].value));
+    }
+    REQUIRE(copied[2].value.flags.value == 0x21);
+}
+
+TEST_CASE(SUITE("range block collection decodes straight into columns"))
+{
+    // g30v1 w/ values 10, 11, 12
+    const uint8_t bytes[] = {0x01, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x00, 0x21, 0x0C, 0x00, 0x00, 0x00};
+    RangeBlockCollection<FlagsAndValueBlockDecoder<Group30Var1>> collection(ser4cpp::rseq_t(bytes, sizeof(bytes)),
+                                                                            Range::From(7, 9));
+
+    uint16_t indices[3];
+    double values[3];
+    uint8_t flags[3];
+    const IMeasurementCollection<Analog>& measurements = collection;
+    measurements.CopyTo(MeasurementColumns<Analog>(indices, values, flags, nullptr));
+
+    for (uint16_t i = 0; i < 3; ++i)
+    {
+        REQUIRE(indices[i] == 7 + i);
+        REQUIRE(values[i] == 10 + i);
+    }
+    REQUIRE(flags[0] == 0x01);
+    REQUIRE(flags[2] == 0x21);
+}
+
+TEST_CASE(SUITE("range bitfield collection matches GetBit"))
+{
+    std::mt19937 gen(7);
+
+    for (size_t count = 1; count < 40; ++count)
+    {
+        const auto bytes = RandomBytes(gen, NumBytesInBits(count));
+        const ser4cpp::rseq_t buffer(bytes.data(), bytes.size());
+        const auto range = Range::From(100, static_cast<uint16_t>(100 + count - 1));
+
+        RangeBitfieldCollection<Binary> collection(buffer, range);
+        std::vector<Indexed<Binary>> values(count);
+        collection.CopyTo(values.data());
+
+        size_t pos = 0;
+        collection.ForeachItem([&](const Indexed<Binary>& value) {
+            REQUIRE(value.index == 100 + pos);
+            REQUIRE(SameMeasurement(value.value, Binary(GetBit(buffer, pos))));
+            REQUIRE(SameMeasurement(value.value, values[pos].value));
+            ++pos;
+        });
+        REQUIRE(pos == count);
+    }
+}
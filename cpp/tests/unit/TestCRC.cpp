@@ -21,8 +21,10 @@
 
 #include <catch.hpp>
 #include <link/CRC.h>
+#include <link/LinkLayerConstants.h>
 
 #include <iostream>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -37,3 +39,70 @@ TEST_CASE(SUITE("CrcTest"))
     REQUIRE(hs.Size() == 10);
     REQUIRE(CRC::CalcCrc(hs, 8) == 0x21E9);
 }
+
+namespace
+{
+std::vector<uint8_t> random_bytes(std::mt19937& gen, size_t length)
+{
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> bytes(length);
+    for (auto& byte : bytes)
+    {
+        byte = static_cast<uint8_t>(dist(gen));
+    }
+    return bytes;
+}
+
+// interleave a CRC after every 16 byte block the same way a link frame body is formatted
+std::vector<uint8_t> format_body(const std::vector<uint8_t>& user_data)
+{
+    std::vector<uint8_t> body;
+    for (size_t pos = 0; pos < user_data.size(); pos += LPDU_DATA_BLOCK_SIZE)
+    {
+        const auto num = std::min<size_t>(LPDU_DATA_BLOCK_SIZE, user_data.size() - pos);
+        const auto start = body.size();
+        body.insert(body.end(), user_data.begin() + pos, user_data.begin() + pos + num);
+        body.resize(body.size() + LPDU_CRC_SIZE);
+        CRC::AddCrc(body.data() + start, num);
+    }
+    return body;
+}
+} // namespace
+
+TEST_CASE(SUITE("Sliced CRC matches the bytewise CRC for every length"))
+{
+    std::mt19937 gen(20);
+
+    for (size_t length = 0; length <= 300; ++length)
+    {
+        const auto bytes = random_bytes(gen, length);
+        REQUIRE(CRC::CalcCrc(bytes.data(), length) == CRC::CalcCrcBytewise(bytes.data(), length));
+    }
+}
+
+TEST_CASE(SUITE("Block CRCs are validated for every user data length"))
+{
+    std::mt19937 gen(21);
+
+    for (size_t length = 0; length <= LPDU_MAX_USER_DATA_SIZE; ++length)
+    {
+        const auto user_data = random_bytes(gen, length);
+        const auto body = format_body(user_data);
+        REQUIRE(CRC::AreBlockCRCsCorrect(body.data(), length));
+    }
+}
+
+TEST_CASE(SUITE("A corrupted byte in any block fails validation"))
+{
+    std::mt19937 gen(22);
+
+    const auto user_data = random_bytes(gen, 250);
+    const auto body = format_body(user_data);
+
+    for (size_t i = 0; i < body.size(); ++i)
+    {
+        auto corrupted = body;
+        corrupted[i] ^= 0x01;
+        REQUIRE_FALSE(CRC::AreBlockCRCsCorrect(corrupted.data(), user_data.size()));
+    }
+}
@@ -43,3 +43,33 @@ TEST_CASE(SUITE("Map integers to booleans"))
     REQUIRE(items[2]);
     REQUIRE(items[3]);
 }
+
+TEST_CASE(SUITE("CopyTo applies a transform that keeps the type"))
+{
+    int values[4] = {1, 2, 3, 4};
+    ArrayCollection<int> collectionInt(values, 4);
+    auto doubled = Map<int, int>(collectionInt, [](const int& x) -> int { return 2 * x; });
+
+    int items[4] = {0};
+    doubled.CopyTo(items);
+
+    REQUIRE(items[0] == 2);
+    REQUIRE(items[1] == 4);
+    REQUIRE(items[2] == 6);
+    REQUIRE(items[3] == 8);
+}
+
+TEST_CASE(SUITE("CopyTo applies a transform that changes the type"))
+{
+    int values[4] = {1, 2, 3, 4};
+    ArrayCollection<int> collectionInt(values, 4);
+    auto collectionBool = Map<int, bool>(collectionInt, [](const int& x) -> bool { return x > 2; });
+
+    bool items[4] = {true, true, false, false};
+    collectionBool.CopyTo(items);
+
+    REQUIRE_FALSE(items[0]);
+    REQUIRE_FALSE(items[1]);
+    REQUIRE(items[2]);
+    REQUIRE(items[3]);
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <app/DeadbandKernel.h>
+
+#include <catch.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "DeadbandKernel - " name
+
+namespace
+{
+const DeadbandKernel::Isa all_isas[]
+    = {DeadbandKernel::Isa::scalar, DeadbandKernel::Isa::sse2, DeadbandKernel::Isa::avx2};
+
+const char* to_string(DeadbandKernel::Isa isa)
+{
+    switch (isa)
+    {
+    case (DeadbandKernel::Isa::sse2):
+        return "sse2";
+    case (DeadbandKernel::Isa::avx2):
+        return "avx2";
+    default:
+        return "scalar";
+    }
+}
+
+// values that exercise the special cases of the comparisons
+double random_double(std::mt19937& gen)
+{
+    static const double specials[] = {0.0,
+                                      -0.0,
+                                      1.0,
+                                      -1.0,
+                                      INFINITY,
+                                      -INFINITY,
+                                      std::numeric_limits<double>::quiet_NaN(),
+                                      std::numeric_limits<double>::max(),
+                                      std::numeric_limits<double>::lowest(),
+                                      std::numeric_limits<double>::denorm_min()};
+
+    if (gen() % 4 == 0)
+    {
+        return specials[gen() % (sizeof(specials) / sizeof(specials[0]))];
+    }
+
+    return std::uniform_real_distribution<double>(-10.0, 10.0)(gen);
+}
+
+uint32_t random_uint32(std::mt19937& gen)
+{
+    static const uint32_t specials[] = {0, 1, 0x7FFFFFFF, 0x80000000, 0x80000001, 0xFFFFFFFE, 0xFFFFFFFF};
+
+    if (gen() % 4 == 0)
+    {
+        return specials[gen() % (sizeof(specials) / sizeof(specials[0]))];
+    }
+
+    return gen() % 20;
+}
+
+uint8_t random_flags(std::mt19937& gen)
+{
+    return (gen() % 8 == 0) ? static_cast<uint8_t>(gen()) : 0x01;
+}
+
+void fill(DeadbandBlock<double>& block, std::mt19937& gen)
+{
+    for (size_t i = 0; i < DeadbandBlock<double>::max_size; ++i)
+    {
+        block.old_values[i] = random_double(gen);
+        block.new_values[i] = (gen() % 4 == 0) ? block.old_values[i] : random_double(gen);
+        block.deadbands[i] = (gen() % 2 == 0) ? 0.0 : random_double(gen);
+        block.old_flags[i] = random_flags(gen);
+        block.new_flags[i] = random_flags(gen);
+    }
+}
+
+void fill(DeadbandBlock<uint32_t>& block, std::mt19937& gen)
+{
+    for (size_t i = 0; i < DeadbandBlock<uint32_t>::max_size; ++i)
+    {
+        block.old_values[i] = random_uint32(gen);
+        block.new_values[i] = (gen() % 4 == 0) ? block.old_values[i] : random_uint32(gen);
+        block.deadbands[i] = (gen() % 2 == 0) ? 0 : random_uint32(gen);
+        block.old_flags[i] = random_flags(gen);
+        block.new_flags[i] = random_flags(gen);
+    }
+}
+
+// the reference result computed by the measurement specs
+template<class Spec, class T> uint64_t expected_events(const DeadbandBlock<T>& block, size_t count)
+{
+    uint64_t mask = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        typename Spec::config_t config;
+        config.deadband = block.deadbands[i];
+        const typename Spec::meas_t old_value(block.old_values[i], Flags(block.old_flags[i]));
+        const typename Spec::meas_t new_value(block.new_values[i], Flags(block.new_flags[i]));
+        if (Spec::IsEvent(old_value, new_value, config))
+        {
+            mask |= uint64_t(1) << i;
+        }
+    }
+    return mask;
+}
+
+template<class Spec, class T> void test_matches_spec()
+{
+    std::mt19937 gen(1815);
+    DeadbandBlock<T> block;
+
+    for (auto isa : all_isas)
+    {
+        if (!DeadbandKernel::is_supported(isa))
+        {
+            continue;
+        }
+
+        INFO("isa: " << to_string(isa));
+
+        for (int iteration = 0; iteration < 100; ++iteration)
+        {
+            fill(block, gen);
+            for (size_t count = 0; count <= DeadbandBlock<T>::max_size; ++count)
+            {
+                INFO("count: " << count);
+                REQUIRE(DeadbandKernel::detect_events(block, count, isa) == expected_events<Spec>(block, count));
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE(SUITE("scalar implementation is always supported"))
+{
+    REQUIRE(DeadbandKernel::is_supported(DeadbandKernel::Isa::scalar));
+    REQUIRE(DeadbandKernel::is_supported(DeadbandKernel::best_isa()));
+}
+
+TEST_CASE(SUITE("analog results are identical to AnalogSpec::IsEvent"))
+{
+    test_matches_spec<AnalogSpec, double>();
+}
+
+TEST_CASE(SUITE("counter results are identical to CounterSpec::IsEvent"))
+{
+    test_matches_spec<CounterSpec, uint32_t>();
+}
+
+TEST_CASE(SUITE("frozen counter results are identical to FrozenCounterSpec::IsEvent"))
+{
+    test_matches_spec<FrozenCounterSpec, uint32_t>();
+}
+
+TEST_CASE(SUITE("analog output status results are identical to AnalogOutputStatusSpec::IsEvent"))
+{
+    test_matches_spec<AnalogOutputStatusSpec, double>();
+}
@@ -153,3 +153,165 @@ TEST_CASE(SUITE("selected events discarded on overflow"))
     MockEventWriteHandler handler;
     REQUIRE(storage.Write(handler) == 0);
 }
+
+TEST_CASE(SUITE("overflow only discards the oldest event of the overflowing type"))
+{
+    EventBufferConfig config;
+    config.maxBinaryEvents = 2;
+    config.maxAnalogEvents = 2;
+    EventStorage storage(config);
+
+    REQUIRE_FALSE(
+        storage.Update(Event<BinarySpec>(Binary(true), 0, EventClass::EC1, EventBinaryVariation::Group2Var1)));
+    REQUIRE_FALSE(
+        storage.Update(Event<AnalogSpec>(Analog(1.0), 1, EventClass::EC1, EventAnalogVariation::Group32Var1)));
+    REQUIRE_FALSE(
+        storage.Update(Event<BinarySpec>(Binary(true), 2, EventClass::EC1, EventBinaryVariation::Group2Var1)));
+    REQUIRE(storage.Update(Event<BinarySpec>(Binary(true), 3, EventClass::EC1, EventBinaryVariation::Group2Var1)));
+
+    REQUIRE(storage.NumUnwritten(EventClass::EC1) == 3);
+    REQUIRE(storage.SelectByClass(EventClass::EC1) == 3);
+
+    MockEventWriteHandler handler;
+    handler.Expect(EventAnalogVariation::Group32Var1, 1);
+    handler.Expect(EventBinaryVariation::Group2Var1, 2);
+
+    REQUIRE(storage.Write(handler) == 3);
+    handler.AssertEmpty();
+}
+
+TEST_CASE(SUITE("insertion order is preserved across many overflows"))
+{
+    EventStorage storage(EventBufferConfig::AllTypes(3));
+
+    REQUIRE_FALSE(
+        storage.Update(Event<AnalogSpec>(Analog(1.0), 0, EventClass::EC1, EventAnalogVariation::Group32Var1)));
+    REQUIRE_FALSE(
+        storage.Update(Event<CounterSpec>(Counter(1), 0, EventClass::EC2, EventCounterVariation::Group22Var1)));
+
+    for (uint16_t i = 0; i < 1000; ++i)
+    {
+        storage.Update(Event<BinarySpec>(Binary(true), i, EventClass::EC1, EventBinaryVariation::Group2Var1));
+    }
+
+    REQUIRE(storage.NumUnwritten(EventClass::EC1) == 4);
+    REQUIRE(storage.NumUnwritten(EventClass::EC2) == 1);
+    REQUIRE(storage.SelectByClass(ClassField::AllEventClasses()) == 5);
+
+    MockEventWriteHandler handler;
+    handler.Expect(EventAnalogVariation::Group32Var1, 1);
+    handler.Expect(EventCounterVariation::Group22Var1, 1);
+    handler.Expect(EventBinaryVariation::Group2Var1, 3);
+
+    REQUIRE(storage.Write(handler) == 5);
+    handler.AssertEmpty();
+}
+
+TEST_CASE(SUITE("clearing written events keeps the remaining events in order"))
+{
+    EventStorage storage(EventBufferConfig::AllTypes(10));
+
+    REQUIRE_FALSE(
+        storage.Update(Event<BinarySpec>(Binary(true), 0, EventClass::EC1, EventBinaryVariation::Group2Var1)));
+    REQUIRE_FALSE(
+        storage.Update(Event<AnalogSpec>(Analog(1.0), 0, EventClass::EC1, EventAnalogVariation::Group32Var1)));
+    REQUIRE_FALSE(
+        storage.Update(Event<BinarySpec>(Binary(true), 1, EventClass::EC1, EventBinaryVariation::Group2Var1)));
+    REQUIRE_FALSE(
+        storage.Update(Event<AnalogSpec>(Analog(1.0), 1, EventClass::EC1, EventAnalogVariation::Group32Var1)));
+
+    REQUIRE(storage.SelectByType(EventBinaryVariation::Group2Var2, 10) == 2);
+
+    MockEventWriteHandler handler;
+    handler.Expect(EventBinaryVariation::Group2Var2, 2);
+    REQUIRE(storage.Write(handler) == 2);
+    handler.AssertEmpty();
+
+    REQUIRE(storage.ClearWritten() == 2);
+    REQUIRE(storage.NumUnwritten(EventClass::EC1) == 2);
+    REQUIRE(storage.SelectByClass(EventClass::EC1) == 2);
+
+    handler.Expect(EventAnalogVariation::Group32Var1, 2);
+    REQUIRE(storage.Write(handler) == 2);
+    handler.AssertEmpty();
+}
+
+TEST_CASE(SUITE("unselect reverts selected and written events"))
+{
+    EventStorage storage(EventBufferConfig::AllTypes(1));
+
+    REQUIRE_FALSE(
+        storage.Update(Event<BinarySpec>(Binary(true), 0, EventClass::EC1, EventBinaryVariation::Group2Var1)));
+    REQUIRE(storage.Update(Event<BinarySpec>(Binary(true), 1, EventClass::EC1, EventBinaryVariation::Group2Var1)));
+    REQUIRE_FALSE(
+        storage.Update(Event<AnalogSpec>(Analog(1.0), 0, EventClass::EC1, EventAnalogVariation::Group32Var1)));
+
+    REQUIRE(storage.SelectByClass(EventClass::EC1) == 2);
+
+    MockEventWriteHandler handler;
+    handler.Expect(EventBinaryVariation::Group2Var1, 1);
+    handler.Expect(EventAnalogVariation::Group32Var1, 1);
+    REQUIRE(storage.Write(handler) == 2);
+
+    storage.Unselect();
+    REQUIRE(storage.NumSelected() == 0);
+    REQUIRE(storage.NumUnwritten(EventClass::EC1) == 2);
+    REQUIRE(storage.SelectByClass(EventClass::EC1) == 2);
+}
+
+TEST_CASE(SUITE("class selection only selects the requested classes in insertion order"))
+{
+    EventStorage storage(EventBufferConfig::AllTypes(100));
+
+    for (uint16_t i = 0; i < 50; ++i)
+    {
+        REQUIRE_FALSE(
+            storage.Update(Event<BinarySpec>(Binary(true), i, EventClass::EC3, EventBinaryVariation::Group2Var1)));
+    }
+    REQUIRE_FALSE(
+        storage.Update(Event<AnalogSpec>(Analog(1.0), 0, EventClass::EC1, EventAnalogVariation::Group32Var1)));
+    REQUIRE_FALSE(
+        storage.Update(Event<CounterSpec>(Counter(1), 0, EventClass::EC2, EventCounterVariation::Group22Var1)));
+    REQUIRE_FALSE(
+        storage.Update(Event<AnalogSpec>(Analog(2.0), 1, EventClass::EC1, EventAnalogVariation::Group32Var1)));
+
+    REQUIRE(storage.SelectByClass(EventClass::EC1, 1) == 1);
+    REQUIRE(storage.SelectByClass(ClassField(false, true, true, false)) == 2);
+    REQUIRE(storage.NumSelected() == 3);
+
+    MockEventWriteHandler handler;
+    handler.Expect(EventAnalogVariation::Group32Var1, 1);
+    handler.Expect(EventCounterVariation::Group22Var1, 1);
+    handler.Expect(EventAnalogVariation::Group32Var1, 1);
+    REQUIRE(storage.Write(handler) == 3);
+    handler.AssertEmpty();
+
+    REQUIRE(storage.NumUnwritten(EventClass::EC1) == 0);
+    REQUIRE(storage.NumUnwritten(EventClass::EC3) == 50);
+
+    // unselecting restores the class index
+    storage.Unselect();
+    REQUIRE(storage.SelectByClass(EventClass::EC1) == 2);
+    REQUIRE(storage.SelectByClass(EventClass::EC3, 10) == 10);
+    REQUIRE(storage.ClearWritten() == 0);
+}
+
+TEST_CASE(SUITE("events selected by type are not selected again by class"))
+{
+    EventStorage storage(EventBufferConfig::AllTypes(10));
+
+    REQUIRE_FALSE(
+        storage.Update(Event<BinarySpec>(Binary(true), 0, EventClass::EC1, EventBinaryVariation::Group2Var1)));
+    REQUIRE_FALSE(
+        storage.Update(Event<AnalogSpec>(Analog(1.0), 0, EventClass::EC1, EventAnalogVariation::Group32Var1)));
+
+    REQUIRE(storage.SelectByType(EventAnalogVariation::Group32Var2, 10) == 1);
+    REQUIRE(storage.SelectByClass(EventClass::EC1) == 1);
+    REQUIRE(storage.NumSelected() == 2);
+
+    MockEventWriteHandler handler;
+    handler.Expect(EventBinaryVariation::Group2Var1, 1);
+    handler.Expect(EventAnalogVariation::Group32Var2, 1);
+    REQUIRE(storage.Write(handler) == 2);
+    handler.AssertEmpty();
+}
@@ -159,6 +159,33 @@ TEST_CASE(SUITE("UnconfirmedUserData"))
                    "01 00 01 00 01 00 00 01 01 01 00 00 03 00 FF FF 00 1E 02 01 00 00 01 00 01 00 00 01 00 00 FF FF"));
 }
 
+TEST_CASE(SUITE("UnconfirmedUserDataFromTransportHeaderAndPayload"))
+{
+    // the frames must match those formatted from the assembled segment for payloads that end on and around
+    // the boundaries of the CRC blocks
+    for (size_t length = 0; length < 250; ++length)
+    {
+        Buffer segment(length + 1);
+        for (size_t i = 0; i <= length; ++i)
+        {
+            segment.as_wslice()[i] = static_cast<uint8_t>(i + 0xC0);
+        }
+
+        Buffer expected(292);
+        auto expectedDest = expected.as_wslice();
+        const auto expectedFrame
+            = LinkFrame::FormatUnconfirmedUserData(expectedDest, false, 1024, 1, segment.as_rslice(), nullptr);
+
+        Buffer actual(292);
+        auto actualDest = actual.as_wslice();
+        const auto actualFrame = LinkFrame::FormatUnconfirmedUserData(
+            actualDest, false, 1024, 1, segment.as_rslice()[0], segment.as_rslice().skip(1), nullptr);
+
+        REQUIRE(HexConversions::to_hex(actualFrame) == HexConversions::to_hex(expectedFrame));
+        REQUIRE(actualDest.length() == expectedDest.length());
+    }
+}
+
 TEST_CASE(SUITE("LinkStatus"))
 {
     Buffer buffer(292);
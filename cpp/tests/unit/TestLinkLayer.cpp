@@ -17,6 +17,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "utils/BufferHelpers.h"
 #include "utils/LinkHex.h"
 #include "utils/LinkLayerTest.h"
 #include "utils/MockTransportSegment.h"
@@ -24,6 +25,7 @@
 #include <ser4cpp/util/HexConversions.h>
 
 #include <catch.hpp>
+#include <link/LinkFrame.h>
 
 #include <iostream>
 
@@ -259,6 +261,48 @@ TEST_CASE(SUITE("SendUnconfirmed"))
     REQUIRE(t.NumTotalWrites() == 1);
 }
 
+TEST_CASE(SUITE("SendUnconfirmedFormatsAllFramesIntoOneWrite"))
+{
+    LinkLayerTest t;
+    t.link.OnLowerLayerUp();
+
+    MockTransportSegment segments(250, HexConversions::increment_hex(0, 600), Addresses());
+    t.link.Send(segments);
+    REQUIRE(t.NumTotalWrites() == 1);
+
+    const auto hex = t.PopLastWriteAsHex();
+    HexSequence frames(hex);
+    REQUIRE(frames.Size() == 2 * LPDU_MAX_FRAME_SIZE + LinkFrame::CalcFrameSize(100));
+    REQUIRE(LinkFrame::CountFrames(frames.ToRSeq()) == 3);
+
+    t.link.OnTxReady();
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.upper->GetCounters().numTxReady == 1);
+    REQUIRE(t.NumTotalWrites() == 1);
+}
+
+TEST_CASE(SUITE("SendUnconfirmedSplitsWritesAtTheMaximumFrameCount"))
+{
+    LinkLayerTest t;
+    t.link.OnLowerLayerUp();
+
+    const auto num_bytes = static_cast<uint16_t>(250 * (LPDU_MAX_FRAMES_PER_TX + 1));
+    MockTransportSegment segments(250, HexConversions::increment_hex(0, num_bytes), Addresses());
+    t.link.Send(segments);
+    REQUIRE(t.NumTotalWrites() == 1);
+    REQUIRE(LinkFrame::CountFrames(HexSequence(t.PopLastWriteAsHex()).ToRSeq()) == LPDU_MAX_FRAMES_PER_TX);
+
+    t.link.OnTxReady();
+    REQUIRE(t.NumTotalWrites() == 2);
+    REQUIRE(LinkFrame::CountFrames(HexSequence(t.PopLastWriteAsHex()).ToRSeq()) == 1);
+    REQUIRE(t.exe->run_many() == 0);
+
+    t.link.OnTxReady();
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.upper->GetCounters().numTxReady == 1);
+    REQUIRE(t.NumTotalWrites() == 2);
+}
+
 TEST_CASE(SUITE("CloseBehavior"))
 {
     LinkLayerTest t;
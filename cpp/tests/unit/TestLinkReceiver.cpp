@@ -238,6 +238,48 @@ TEST_CASE(SUITE("UnconfirmedUserData"))
     REQUIRE(t.sink.received.Equals(data.ToRSeq()));
 }
 
+TEST_CASE(SUITE("UserDataIsWrittenToTheSinkBuffer"))
+{
+    ByteStr data(250, 0); // initializes a buffer with increasing value
+
+    Buffer buffer(292);
+    auto writeTo = buffer.as_wslice();
+    auto frame = LinkFrame::FormatUnconfirmedUserData(writeTo, true, 1, 2, data.ToRSeq(), nullptr);
+
+    LinkParserTest t;
+    t.sink.userDataBuffer.resize(250);
+    t.WriteData(frame);
+    REQUIRE(t.sink.m_num_frames == 1);
+    REQUIRE(t.sink.m_last_userdata == t.sink.userDataBuffer.data());
+    REQUIRE(t.sink.received.Equals(data.ToRSeq()));
+    REQUIRE(rseq_t(t.sink.userDataBuffer.data(), 250).equals(data.ToRSeq()));
+}
+
+TEST_CASE(SUITE("BodyCRCErrorWithSinkBuffer"))
+{
+    LinkParserTest t;
+    t.sink.userDataBuffer.resize(250);
+    t.WriteData("05 64 14 F3 01 00 00 04 0A 3B C0 C3 01 3C 02 06 3C 03 06 3C 04 06 3C 01 06 9A 11");
+    REQUIRE(t.sink.m_num_frames == 0);
+    REQUIRE(t.parser.Statistics().numBodyCrcError == 1);
+}
+
+TEST_CASE(SUITE("SinkBufferThatIsTooSmallIsNotUsed"))
+{
+    ByteStr data(250, 0); // initializes a buffer with increasing value
+
+    Buffer buffer(292);
+    auto writeTo = buffer.as_wslice();
+    auto frame = LinkFrame::FormatUnconfirmedUserData(writeTo, true, 1, 2, data.ToRSeq(), nullptr);
+
+    LinkParserTest t;
+    t.sink.userDataBuffer.resize(249);
+    t.WriteData(frame);
+    REQUIRE(t.sink.m_num_frames == 1);
+    REQUIRE(t.sink.m_last_userdata != t.sink.userDataBuffer.data());
+    REQUIRE(t.sink.received.Equals(data.ToRSeq()));
+}
+
 TEST_CASE(SUITE("ConfirmedUserData"))
 {
     ByteStr data(250, 0); // initializes a buffer with increasing value
@@ -266,6 +308,45 @@ TEST_CASE(SUITE("TestTwoPackets"))
     REQUIRE(t.sink.CheckLast(LinkFunction::PRI_RESET_LINK_STATES, true, 1, 1024));
 }
 
+TEST_CASE(SUITE("BurstOfFramesIsParsedFromOneRead"))
+{
+    ByteStr data(250, 0); // initializes a buffer with increasing value
+
+    Buffer buffer(9 * LPDU_MAX_FRAME_SIZE);
+    auto writeTo = buffer.as_wslice();
+    for (int i = 0; i < 9; ++i)
+    {
+        LinkFrame::FormatUnconfirmedUserData(writeTo, true, 1, 2, data.ToRSeq(), nullptr);
+    }
+
+    LinkParserTest t;
+    t.WriteData(buffer.as_rslice());
+    REQUIRE(t.sink.m_num_frames == 9);
+    REQUIRE(t.sink.received.Size() == 9 * 250);
+    REQUIRE(t.parser.Statistics().numReads == 1);
+    REQUIRE(t.parser.Statistics().maxFramesPerRead == 9);
+}
+
+TEST_CASE(SUITE("FrameSplitAcrossReadsWithMinimumBuffer"))
+{
+    ByteStr data(250, 0); // initializes a buffer with increasing value
+
+    Buffer buffer(LPDU_MAX_FRAME_SIZE);
+    auto writeTo = buffer.as_wslice();
+    auto frame = LinkFrame::FormatUnconfirmedUserData(writeTo, true, 1, 2, data.ToRSeq(), nullptr);
+
+    LinkParserTest t(false, 0); // rounded up to a single frame
+    REQUIRE(t.parser.WriteBuff().length() == LPDU_MAX_FRAME_SIZE);
+
+    t.WriteData(frame.take(100));
+    REQUIRE(t.sink.m_num_frames == 0);
+    t.WriteData(frame.skip(100));
+    REQUIRE(t.sink.m_num_frames == 1);
+    REQUIRE(t.sink.received.Equals(data.ToRSeq()));
+    REQUIRE(t.parser.Statistics().numReads == 2);
+    REQUIRE(t.parser.Statistics().maxFramesPerRead == 1);
+}
+
 //////////////////////////////////////////
 // framing errors
 //////////////////////////////////////////
@@ -779,3 +779,109 @@ TEST_CASE(SUITE("IntegrityPollOnBufferOverflowIIN"))
     REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(1));
     t.context->OnTxReady();
 }
+
+TEST_CASE(SUITE("task runs at its later expiration after the task timer fires early"))
+{
+    MasterTestFixture t(NoStartupTasks());
+    const auto startTime = t.exe->get_time();
+    t.context->OnLowerLayerUp();
+    t.exe->run_many();
+
+    auto scan = t.context->AddClassScan(ClassField::AllClasses(), TimeDuration::Seconds(10), t.meas);
+
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+    t.context->OnTxReady();
+    t.SendToMaster(hex::EmptyResponse(0));
+    t.exe->run_many();
+
+    // the timer is armed for 10 seconds, demanding the scan at 2 seconds moves its next run out to 12 seconds
+    t.exe->advance_time(std::chrono::seconds(2));
+    t.scheduler->Demand(scan);
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(1));
+    t.context->OnTxReady();
+    t.SendToMaster(hex::EmptyResponse(1));
+    t.exe->run_many();
+
+    // the timer wakes up early and only re-evaluates
+    REQUIRE(t.exe->advance_to_next_timer());
+    REQUIRE(t.exe->get_time() - startTime == std::chrono::seconds(10));
+    t.exe->run_many();
+    REQUIRE(t.lower->PopWriteAsHex().empty());
+
+    REQUIRE(t.exe->advance_to_next_timer());
+    REQUIRE(t.exe->get_time() - startTime == std::chrono::seconds(12));
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(2));
+}
+
+TEST_CASE(SUITE("start timeout fires after the task with the earliest timeout is removed"))
+{
+    MasterParams params = NoStartupTasks();
+    params.responseTimeout = TimeDuration::Minutes(1);
+    MasterTestFixture t(params);
+    const auto startTime = t.exe->get_time();
+    t.context->OnLowerLayerUp();
+    t.exe->run_many();
+
+    auto first = std::make_shared<MockTaskCallback>();
+    auto second = std::make_shared<MockTaskCallback>();
+    auto third = std::make_shared<MockTaskCallback>();
+
+    t.context->ScanClasses(ClassField::AllClasses(), t.meas, TaskConfig::With(first));
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+    t.context->OnTxReady();
+
+    // the second scan times out to start at 10 seconds, the third at 13 seconds
+    t.context->ScanClasses(ClassField::AllClasses(), t.meas, TaskConfig::With(second));
+    t.exe->run_many();
+    t.exe->advance_time(std::chrono::seconds(3));
+    t.context->ScanClasses(ClassField::AllClasses(), t.meas, TaskConfig::With(third));
+    t.exe->run_many();
+
+    // the second scan starts and leaves the scheduler, the third waits behind it
+    t.SendToMaster(hex::EmptyResponse(0));
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(1));
+    t.context->OnTxReady();
+    REQUIRE(second->numStart == 1);
+
+    REQUIRE(t.exe->advance_to_next_timer());
+    REQUIRE(t.exe->get_time() - startTime == std::chrono::seconds(10));
+    t.exe->run_many();
+    REQUIRE(third->results.empty());
+
+    REQUIRE(t.exe->advance_to_next_timer());
+    REQUIRE(t.exe->get_time() - startTime == std::chrono::seconds(13));
+    t.exe->run_many();
+    REQUIRE(third->numStart == 0);
+    REQUIRE(third->results == std::deque<TaskCompletion>{TaskCompletion::FAILURE_START_TIMEOUT});
+}
+
+TEST_CASE(SUITE("tasks that are equally ready run in the order they were added"))
+{
+    MasterTestFixture t(NoStartupTasks());
+    t.context->OnLowerLayerUp();
+    t.exe->run_many();
+
+    t.context->ScanClasses(ClassField::AllClasses(), t.meas);
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == hex::IntegrityPoll(0));
+    t.context->OnTxReady();
+
+    t.context->ScanClasses(ClassField(ClassField::CLASS_3), t.meas);
+    t.context->ScanClasses(ClassField(ClassField::CLASS_1), t.meas);
+    t.exe->run_many();
+
+    t.SendToMaster(hex::EmptyResponse(0));
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == hex::EventPoll(1, ClassField(ClassField::CLASS_3)));
+    t.context->OnTxReady();
+
+    t.SendToMaster(hex::EmptyResponse(1));
+    REQUIRE(t.exe->run_many() > 0);
+    REQUIRE(t.lower->PopWriteAsHex() == hex::EventPoll(2, ClassField(ClassField::CLASS_1)));
+    t.context->OnTxReady();
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/BufferHelpers.h"
+
+#include "dnp3mocks/MockLogHandler.h"
+#include "dnp3mocks/MockSOEHandler.h"
+
+#include <opendnp3/master/MeasurementCache.h>
+
+#include <catch.hpp>
+#include <master/MeasurementHandler.h>
+
+using namespace opendnp3;
+
+#define SUITE(name) "MeasurementCacheTestSuite - " name
+
+namespace
+{
+    // g30v1 1 byte start/stop 2 -> 4, values 10, 11, 12
+    const char* const analogs = "1E 01 00 02 04 01 0A 00 00 00 01 0B 00 00 00 21 0C 00 00 00";
+
+    ParseResult Process(const std::string& objects, ISOEHandler& handler)
+    {
+        MockLogHandler log;
+        HexSequence hex(objects);
+        return MeasurementHandler::ProcessMeasurements(ResponseInfo(true, true, true), hex.ToRSeq(), log.logger,
+                                                       &handler);
+    }
+} // namespace
+
+TEST_CASE(SUITE("forwards every value the first time it is reported"))
+{
+    auto soe = std::make_shared<MockSOEHandler>();
+    MeasurementCache cache(soe);
+
+    REQUIRE(Process(analogs, cache) == ParseResult::OK);
+
+    REQUIRE(soe->TotalReceived() == 3);
+    REQUIRE(soe->analogSOE[4].meas.value == 12);
+    REQUIRE_FALSE(soe->analogSOE[4].info.isUnchanged);
+}
+
+TEST_CASE(SUITE("drops static values that are reported again unchanged"))
+{
+    auto soe = std::make_shared<MockSOEHandler>();
+    MeasurementCache cache(soe);
+
+    REQUIRE(Process(analogs, cache) == ParseResult::OK);
+    soe->Clear();
+
+    REQUIRE(Process(analogs, cache) == ParseResult::OK);
+    REQUIRE(soe->TotalReceived() == 0);
+}
+
+TEST_CASE(SUITE("forwards only the values whose value or flags changed"))
+{
+    auto soe = std::make_shared<MockSOEHandler>();
+    MeasurementCache cache(soe);
+
+    REQUIRE(Process(analogs, cache) == ParseResult::OK);
+    soe->Clear();
+
+    // index 2 changes flags, index 3 changes value
+    REQUIRE(Process("1E 01 00 02 04 21 0A 00 00 00 01 0D 00 00 00 21 0C 00 00 00", cache) == ParseResult::OK);
+
+    REQUIRE(soe->TotalReceived() == 2);
+    REQUIRE(soe->analogSOE[2].meas.flags.value == 0x21);
+    REQUIRE(soe->analogSOE[3].meas.value == 13);
+    REQUIRE(soe->analogSOE.count(4) == 0);
+}
+
+TEST_CASE(SUITE("drops analogs that stay at NaN"))
+{
+    auto soe = std::make_shared<MockSOEHandler>();
+    MeasurementCache cache(soe);
+
+    // g30v5 1 byte start/stop 0 -> 0, flags 0x01, value NaN
+    const char* const nan = "1E 05 00 00 00 01 00 00 C0 7F";
+
+    REQUIRE(Process(nan, cache) == ParseResult::OK);
+    REQUIRE(soe->TotalReceived() == 1);
+
+    REQUIRE(Process(nan, cache) == ParseResult::OK);
+    REQUIRE(soe->TotalReceived() == 1);
+}
+
+TEST_CASE(SUITE("can flag unchanged values instead of dropping them"))
+{
+    auto soe = std::make_shared<MockSOEHandler>();
+    MeasurementCache cache(soe, MeasurementCache::Unchanged::Flag);
+
+    REQUIRE(Process(analogs, cache) == ParseResult::OK);
+    soe->Clear();
+
+    REQUIRE(Process("1E 01 00 02 04 01 0A 00 00 00 01 0D 00 00 00 21 0C 00 00 00", cache) == ParseResult::OK);
+
+    REQUIRE(soe->TotalReceived() == 3);
+    REQUIRE_FALSE(soe->analogSOE[3].info.isUnchanged);
+    REQUIRE(soe->analogSOE[2].info.isUnchanged);
+    REQUIRE(soe->analogSOE[4].info.isUnchanged);
+}
+
+TEST_CASE(SUITE("forwards events untouched and uses them to update the table"))
+{
+    auto soe = std::make_shared<MockSOEHandler>();
+    MeasurementCache cache(soe);
+
+    // g2v1 count of 1 index 8, value of true twice
+    REQUIRE(Process("02 01 17 01 08 81", cache) == ParseResult::OK);
+    REQUIRE(Process("02 01 17 01 08 81", cache) == ParseResult::OK);
+    REQUIRE(soe->TotalReceived() == 2);
+
+    // g1v2 1 byte start/stop 8 -> 8 with the same value
+    REQUIRE(Process("01 02 00 08 08 81", cache) == ParseResult::OK);
+    REQUIRE(soe->TotalReceived() == 2);
+}
+
+TEST_CASE(SUITE("answers point and snapshot queries"))
+{
+    auto soe = std::make_shared<MockSOEHandler>();
+    MeasurementCache cache(soe);
+
+    REQUIRE(Process(analogs, cache) == ParseResult::OK);
+
+    Analog value;
+    REQUIRE(cache.Get(3, value));
+    REQUIRE(value.value == 11);
+    REQUIRE_FALSE(cache.Get(1, value));
+    REQUIRE_FALSE(cache.Get(5, value));
+
+    Binary binary;
+    REQUIRE_FALSE(cache.Get(3, binary));
+
+    const auto snapshot = cache.Snapshot();
+    REQUIRE(snapshot.binaries.empty());
+    REQUIRE(snapshot.analogs.size() == 3);
+    REQUIRE(snapshot.analogs[0].index == 2);
+    REQUIRE(snapshot.analogs[2].value.flags.value == 0x21);
+}
+
+TEST_CASE(SUITE("forwards every value again after being cleared"))
+{
+    auto soe = std::make_shared<MockSOEHandler>();
+    MeasurementCache cache(soe);
+
+    REQUIRE(Process(analogs, cache) == ParseResult::OK);
+    cache.Clear();
+    soe->Clear();
+
+    REQUIRE(Process(analogs, cache) == ParseResult::OK);
+    REQUIRE(soe->TotalReceived() == 3);
+}
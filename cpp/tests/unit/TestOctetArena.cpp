@@ -0,0 +1,127 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <outstation/OctetArena.h>
+#include <outstation/ValueArray.h>
+
+#include <catch.hpp>
+
+#include <string>
+
+using namespace opendnp3;
+
+#define SUITE(name) "OctetArena - " name
+
+namespace
+{
+Buffer to_buffer(const std::string& value)
+{
+    return Buffer(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+}
+
+std::string to_string(const Buffer& buffer)
+{
+    return std::string(reinterpret_cast<const char*>(buffer.data), buffer.length);
+}
+} // namespace
+
+TEST_CASE(SUITE("stores strings of every length"))
+{
+    OctetArena arena;
+
+    std::vector<OctetArena::handle_t> handles;
+    for (size_t length = 0; length <= OctetData::MAX_SIZE; ++length)
+    {
+        handles.push_back(arena.Allocate(to_buffer(std::string(length, static_cast<char>('a' + length % 26)))));
+    }
+
+    for (size_t length = 0; length <= OctetData::MAX_SIZE; ++length)
+    {
+        REQUIRE(to_string(arena.Get(handles[length])) == std::string(length, static_cast<char>('a' + length % 26)));
+    }
+}
+
+TEST_CASE(SUITE("truncates strings longer than the maximum size"))
+{
+    OctetArena arena;
+
+    const size_t max_size = OctetData::MAX_SIZE;
+    const auto handle = arena.Allocate(to_buffer(std::string(300, 'x')));
+    REQUIRE(arena.Get(handle).length == max_size);
+}
+
+TEST_CASE(SUITE("small strings only use a small chunk"))
+{
+    OctetArena arena;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        arena.Allocate(to_buffer("abcd"));
+    }
+
+    // 8 byte chunks rounded up to whole slabs
+    REQUIRE(arena.Capacity() < 1000 * 16);
+}
+
+TEST_CASE(SUITE("freed chunks are reused"))
+{
+    OctetArena arena;
+
+    const auto first = arena.Allocate(to_buffer("first"));
+    const auto capacity = arena.Capacity();
+
+    arena.Free(first);
+    const auto second = arena.Allocate(to_buffer("second"));
+
+    REQUIRE(second == first);
+    REQUIRE(arena.Capacity() == capacity);
+    REQUIRE(to_string(arena.Get(second)) == "second");
+}
+
+TEST_CASE(SUITE("replace keeps the chunk within a size class and moves it otherwise"))
+{
+    OctetArena arena;
+
+    const auto handle = arena.Allocate(to_buffer("abc"));
+    const auto other = arena.Allocate(to_buffer("xyz"));
+
+    const auto same = arena.Replace(handle, to_buffer("abcdef"));
+    REQUIRE(same == handle);
+    REQUIRE(to_string(arena.Get(same)) == "abcdef");
+
+    const auto moved = arena.Replace(same, to_buffer(std::string(100, 'z')));
+    REQUIRE(to_string(arena.Get(moved)) == std::string(100, 'z'));
+    REQUIRE(to_string(arena.Get(other)) == "xyz");
+}
+
+TEST_CASE(SUITE("octet string value arrays round trip values"))
+{
+    ValueArray<OctetString> values;
+
+    values.push_back(OctetString("hello"));
+    values.resize(3);
+    values.insert(0, OctetString(Buffer()));
+    values.set(2, OctetString(std::string(200, 'q').c_str()));
+
+    REQUIRE(values.size() == 4);
+    REQUIRE(to_string(values.get(0).ToBuffer()) == std::string(1, '\0'));
+    REQUIRE(to_string(values.get(1).ToBuffer()) == "hello");
+    REQUIRE(to_string(values.get(2).ToBuffer()) == std::string(200, 'q'));
+    REQUIRE(to_string(values.get(3).ToBuffer()) == std::string(1, '\0'));
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <catch.hpp>
+#include <outstation/SlotBitset.h>
+
+using namespace opendnp3;
+
+#define SUITE(name) "SlotBitset - " name
+
+TEST_CASE(SUITE("find_next returns size when nothing is set"))
+{
+    SlotBitset bits;
+    bits.resize(130);
+
+    REQUIRE_FALSE(bits.any());
+    REQUIRE(bits.find_next(0) == 130);
+    REQUIRE(bits.find_next(200) == 130);
+}
+
+TEST_CASE(SUITE("find_next locates set bits across word boundaries"))
+{
+    SlotBitset bits;
+    bits.resize(200);
+
+    bits.set(3);
+    bits.set(64);
+    bits.set(199);
+
+    REQUIRE(bits.find_next(0) == 3);
+    REQUIRE(bits.find_next(4) == 64);
+    REQUIRE(bits.find_next(65) == 199);
+
+    bits.reset(64);
+    REQUIRE(bits.find_next(4) == 199);
+}
+
+TEST_CASE(SUITE("set_all does not set bits beyond the size"))
+{
+    SlotBitset bits;
+    bits.resize(70);
+    bits.set_all();
+
+    REQUIRE(bits.find_next(69) == 69);
+    bits.reset(69);
+    REQUIRE(bits.find_next(69) == 70);
+
+    bits.resize(80);
+    REQUIRE(bits.find_next(69) == 80);
+}
+
+TEST_CASE(SUITE("set_range sets only the half-open interval"))
+{
+    SlotBitset bits;
+    bits.resize(300);
+    bits.set_range(60, 260);
+
+    REQUIRE(bits.find_next(0) == 60);
+    REQUIRE(bits.test(259));
+    REQUIRE_FALSE(bits.test(260));
+    REQUIRE(bits.find_next(260) == 300);
+
+    bits.reset_all();
+    REQUIRE_FALSE(bits.any());
+}
+
+TEST_CASE(SUITE("insert shifts bits at or above the position"))
+{
+    SlotBitset bits;
+    bits.resize(3);
+    bits.set(0);
+    bits.set(2);
+
+    bits.insert(1);
+
+    REQUIRE(bits.size() == 4);
+    REQUIRE(bits.test(0));
+    REQUIRE_FALSE(bits.test(1));
+    REQUIRE_FALSE(bits.test(2));
+    REQUIRE(bits.test(3));
+}
@@ -21,12 +21,15 @@
 #include <catch.hpp>
 #include <outstation/StaticDataMap.h>
 
+#include <vector>
+
 using namespace opendnp3;
 
 struct EventReceiver : public IEventReceiver
 {
     size_t count = 0;
     Event<BinarySpec> latestBinaryEvent;
+    std::vector<Event<AnalogSpec>> analogEvents;
 
     void Update(const Event<BinarySpec>& evt)
     {
@@ -42,6 +45,7 @@ struct EventReceiver : public IEventReceiver
     void Update(const Event<AnalogSpec>& evt)
     {
         ++count;
+        analogEvents.push_back(evt);
     }
 
     void Update(const Event<CounterSpec>& evt)
@@ -392,3 +396,262 @@ TEST_CASE(SUITE("can select disjoint ranges and iterate over them"))
     REQUIRE(items[1].first == 2);
     REQUIRE(items[2].first == 9);
 }
+
+TEST_CASE(SUITE("can update and select points in a dense configuration"))
+{
+    std::map<uint16_t, BinaryConfig> config;
+    for (uint16_t i = 10; i < 110; ++i)
+    {
+        if (i != 50)
+        {
+            config[i] = {};
+        }
+    }
+
+    StaticDataMap<BinarySpec> map{config};
+
+    EventReceiver receiver;
+    REQUIRE_FALSE(map.update(Binary(true), 9, EventMode::Suppress, receiver));
+    REQUIRE_FALSE(map.update(Binary(true), 50, EventMode::Suppress, receiver));
+    REQUIRE_FALSE(map.update(Binary(true), 110, EventMode::Suppress, receiver));
+    REQUIRE(map.update(Binary(true), 51, EventMode::Suppress, receiver));
+
+    REQUIRE(map.select(Range::From(49, 52)) == 3);
+    std::vector<StaticDataMap<BinarySpec>::iterator::value_type> items;
+    for (const auto& item : map)
+    {
+        items.push_back(item);
+    }
+
+    REQUIRE(items.size() == 3);
+    REQUIRE(items[0].first == 49);
+    REQUIRE(items[1].first == 51);
+    REQUIRE(items[1].second.value.value == true);
+    REQUIRE(items[2].first == 52);
+}
+
+TEST_CASE(SUITE("can update and select points in a sparse configuration"))
+{
+    StaticDataMap<BinarySpec> map{{
+        {0, {}},
+        {1000, {}},
+        {65535, {}},
+    }};
+
+    EventReceiver receiver;
+    REQUIRE_FALSE(map.update(Binary(true), 999, EventMode::Suppress, receiver));
+    REQUIRE(map.update(Binary(true), 65535, EventMode::Suppress, receiver));
+
+    REQUIRE(map.select(Range::From(1, 65535)) == 2);
+    std::vector<StaticDataMap<BinarySpec>::iterator::value_type> items;
+    for (const auto& item : map)
+    {
+        items.push_back(item);
+    }
+
+    REQUIRE(items.size() == 2);
+    REQUIRE(items[0].first == 1000);
+    REQUIRE(items[1].first == 65535);
+    REQUIRE(items[1].second.value.value == true);
+}
+
+TEST_CASE(SUITE("adding a point keeps the points ordered by index"))
+{
+    StaticDataMap<BinarySpec> map{{
+        {1, {}},
+        {7, {}},
+    }};
+
+    REQUIRE(map.add(Binary(true), 4, BinaryConfig()));
+    REQUIRE_FALSE(map.add(Binary(), 4, BinaryConfig()));
+
+    REQUIRE(map.select_all() == 3);
+    std::vector<StaticDataMap<BinarySpec>::iterator::value_type> items;
+    for (const auto& item : map)
+    {
+        items.push_back(item);
+    }
+
+    REQUIRE(items.size() == 3);
+    REQUIRE(items[0].first == 1);
+    REQUIRE(items[1].first == 4);
+    REQUIRE(items[1].second.value.value == true);
+    REQUIRE(items[2].first == 7);
+}
+
+TEST_CASE(SUITE("selected values are preserved when the point changes before it is read"))
+{
+    StaticDataMap<BinarySpec> map{{
+        {0, {}},
+        {1, {}},
+    }};
+
+    EventReceiver receiver;
+    REQUIRE(map.update(Binary(true), 0, EventMode::Suppress, receiver));
+    REQUIRE(map.select_all() == 2);
+
+    REQUIRE(map.update(Binary(false), 0, EventMode::Suppress, receiver));
+    REQUIRE(map.update(Binary(true), 1, EventMode::Suppress, receiver));
+
+    std::vector<StaticDataMap<BinarySpec>::iterator::value_type> items;
+    for (const auto& item : map)
+    {
+        items.push_back(item);
+    }
+
+    REQUIRE(items.size() == 2);
+    REQUIRE(items[0].second.value.value == true);
+    REQUIRE(items[1].second.value.value == false);
+
+    // a new selection reads the current values
+    REQUIRE(map.select_all() == 2);
+    REQUIRE((*map.begin()).second.value.value == false);
+}
+
+TEST_CASE(SUITE("re-selecting a changed point reads its current value"))
+{
+    StaticDataMap<BinarySpec> map{{
+        {0, {}},
+    }};
+
+    EventReceiver receiver;
+    REQUIRE(map.select(0));
+    REQUIRE(map.update(Binary(true), 0, EventMode::Suppress, receiver));
+    REQUIRE((*map.begin()).second.value.value == false);
+
+    REQUIRE(map.select(0));
+    REQUIRE((*map.begin()).second.value.value == true);
+
+    map.clear_selection();
+    REQUIRE_FALSE(map.has_any_selection());
+}
+
+TEST_CASE(SUITE("coalesced updates store the value and defer event detection"))
+{
+    BinaryConfig class0;
+    class0.clazz = PointClass::Class0;
+
+    StaticDataMap<BinarySpec> map{{{0, class0}}};
+    map.set_coalescing(true);
+
+    EventReceiver receiver;
+    REQUIRE(map.update(Binary(true), 0, EventMode::Detect, receiver));
+    REQUIRE(map.update(Binary(false), 0, EventMode::Suppress, receiver));
+    REQUIRE(map.update(Binary(true), 0, EventMode::Detect, receiver));
+    REQUIRE(receiver.count == 0);
+
+    map.select(0);
+    REQUIRE((*map.begin()).second.value.value == true);
+    map.clear_selection();
+
+    // assigning an event class performs the deferred detection against the last coalesced value
+    map.assign_class(PointClass::Class1);
+    REQUIRE(map.update(Binary(true), 0, EventMode::Detect, receiver));
+    REQUIRE(receiver.count == 0);
+    REQUIRE(map.update(Binary(false), 0, EventMode::Detect, receiver));
+    REQUIRE(receiver.count == 1);
+}
+
+TEST_CASE(SUITE("suppressed updates move the deadband baseline of event class points w/ or w/o coalescing"))
+{
+    for (const auto coalesce : {false, true})
+    {
+        AnalogConfig config;
+        config.deadband = 10;
+
+        StaticDataMap<AnalogSpec> map{{{0, config}}};
+        map.set_coalescing(coalesce);
+
+        EventReceiver receiver;
+        REQUIRE(map.update(Analog(20), 0, EventMode::Suppress, receiver));
+        REQUIRE(map.update(Analog(15), 0, EventMode::Suppress, receiver));
+        REQUIRE(receiver.count == 0);
+
+        // the baseline is 20, not the most recent value
+        REQUIRE(map.update(Analog(26), 0, EventMode::Detect, receiver));
+        REQUIRE(receiver.count == 0);
+        REQUIRE(map.update(Analog(31), 0, EventMode::Detect, receiver));
+        REQUIRE(receiver.count == 1);
+    }
+}
+
+TEST_CASE(SUITE("coalescing does not change event detection on event class points"))
+{
+    BinaryConfig class0;
+    class0.clazz = PointClass::Class0;
+
+    StaticDataMap<BinarySpec> map{{{0, {}}, {1, class0}}};
+    map.set_coalescing(true);
+
+    EventReceiver receiver;
+    REQUIRE(map.update(Binary(true), 0, EventMode::Detect, receiver));
+    REQUIRE(map.update(Binary(false), 0, EventMode::Detect, receiver));
+    REQUIRE(receiver.count == 2);
+
+    REQUIRE(map.update(Binary(true), 1, EventMode::Detect, receiver));
+    REQUIRE(map.update(Binary(false), 1, EventMode::Detect, receiver));
+    REQUIRE(receiver.count == 2);
+
+    REQUIRE(map.update(Binary(true), 1, EventMode::Force, receiver));
+    REQUIRE(receiver.count == 2);
+}
+
+TEST_CASE(SUITE("batched analog updates produce the same events as individual updates"))
+{
+    std::map<uint16_t, AnalogConfig> config;
+    for (uint16_t i = 0; i < 100; ++i)
+    {
+        config[i].deadband = (i % 3);
+        config[i].clazz = (i % 10 == 0) ? PointClass::Class0 : PointClass::Class1;
+    }
+
+    // contiguous runs longer than a block, repeated and unknown indices and every event mode
+    std::vector<UpdateBatch::Record<Analog>> records;
+    for (uint16_t i = 0; i < 100; ++i)
+    {
+        records.push_back({Analog(i % 7, Flags(0x01)), i, EventMode::Detect});
+    }
+    records.push_back({Analog(2.5), 5, EventMode::Detect});
+    records.push_back({Analog(6.0), 5, EventMode::Detect});
+    records.push_back({Analog(6.0), 200, EventMode::Detect});
+    records.push_back({Analog(1.0, Flags(0x02)), 6, EventMode::Detect});
+    records.push_back({Analog(9.0), 7, EventMode::Force});
+    records.push_back({Analog(9.0), 8, EventMode::Suppress});
+    records.push_back({Analog(9.0), 9, EventMode::EventOnly});
+    for (uint16_t i = 0; i < 100; ++i)
+    {
+        records.push_back({Analog(i % 5, Flags(0x01)), i, EventMode::Detect});
+    }
+
+    for (bool coalesce : {false, true})
+    {
+        StaticDataMap<AnalogSpec> batched(config);
+        StaticDataMap<AnalogSpec> individual(config);
+        batched.set_coalescing(coalesce);
+        individual.set_coalescing(coalesce);
+
+        EventReceiver batched_receiver;
+        EventReceiver individual_receiver;
+
+        batched.update(records.data(), records.size(), batched_receiver);
+        for (const auto& record : records)
+        {
+            individual.update(record.meas, record.index, record.mode, individual_receiver);
+        }
+
+        REQUIRE(batched_receiver.analogEvents.size() == individual_receiver.analogEvents.size());
+        for (size_t i = 0; i < batched_receiver.analogEvents.size(); ++i)
+        {
+            REQUIRE(batched_receiver.analogEvents[i].index == individual_receiver.analogEvents[i].index);
+            REQUIRE(batched_receiver.analogEvents[i].value.value == individual_receiver.analogEvents[i].value.value);
+        }
+
+        REQUIRE(batched.select_all() == individual.select_all());
+        for (auto a = batched.begin(), b = individual.begin(); a != batched.end(); ++a, ++b)
+        {
+            REQUIRE((*a).first == (*b).first);
+            REQUIRE((*a).second.value.value == (*b).second.value.value);
+            REQUIRE((*a).second.value.flags.value == (*b).second.value.flags.value);
+        }
+    }
+}
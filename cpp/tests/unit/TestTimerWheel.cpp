@@ -0,0 +1,348 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <exe4cpp/Timer.h>
+#include <exe4cpp/TimerWheel.h>
+
+#include <catch.hpp>
+
+#include <chrono>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace exe4cpp;
+using namespace std::chrono;
+
+#define SUITE(name) "TimerWheelTestSuite - " name
+
+class TimerWheelTest
+{
+public:
+    TimerWheelTest()
+        : epoch(steady_clock::now()),
+          now(epoch),
+          wheel(
+              epoch,
+              [this](const steady_time_t& expiration) {
+                  this->armed = true;
+                  this->armedAt = expiration;
+                  ++this->numArm;
+              },
+              [this]() {
+                  this->armed = false;
+                  ++this->numDisarm;
+              })
+    {
+    }
+
+    Timer Start(steady_clock::duration delay, const action_t& action)
+    {
+        return Timer(this->wheel.start(this->now + delay, this->now, action));
+    }
+
+    // advance the clock to where the driver is armed and fire it, as the executor would
+    bool FireDriver()
+    {
+        if (!this->armed)
+        {
+            return false;
+        }
+
+        this->armed = false;
+        this->now = std::max(this->now, this->armedAt);
+        this->wheel.expire(this->now);
+        return true;
+    }
+
+    void AdvanceTo(steady_time_t time)
+    {
+        while (this->armed && this->armedAt <= time)
+        {
+            this->FireDriver();
+        }
+
+        this->now = time;
+    }
+
+    const steady_time_t epoch;
+    steady_time_t now;
+
+    bool armed = false;
+    steady_time_t armedAt;
+    size_t numArm = 0;
+    size_t numDisarm = 0;
+
+    TimerWheel wheel;
+};
+
+TEST_CASE(SUITE("TimerExpiresAtItsExpirationAndNotBefore"))
+{
+    TimerWheelTest t;
+    size_t count = 0;
+
+    t.Start(milliseconds(100), [&]() { ++count; });
+
+    // the driver may wake up early to move the timer to a lower level
+    REQUIRE(t.armed);
+    REQUIRE(t.armedAt <= t.epoch + milliseconds(100));
+
+    t.AdvanceTo(t.epoch + milliseconds(99));
+    REQUIRE(count == 0);
+
+    t.AdvanceTo(t.epoch + milliseconds(100));
+    REQUIRE(count == 1);
+    REQUIRE(t.wheel.size() == 0);
+    REQUIRE_FALSE(t.armed);
+}
+
+TEST_CASE(SUITE("SubMillisecondExpirationRoundsUp"))
+{
+    TimerWheelTest t;
+    size_t count = 0;
+
+    t.Start(microseconds(1500), [&]() { ++count; });
+
+    REQUIRE(t.armedAt == t.epoch + milliseconds(2));
+
+    t.wheel.expire(t.epoch + microseconds(1999));
+    REQUIRE(count == 0);
+
+    t.wheel.expire(t.epoch + milliseconds(2));
+    REQUIRE(count == 1);
+}
+
+TEST_CASE(SUITE("CancelRemovesTheTimerAndDisarmsAnEmptyWheel"))
+{
+    TimerWheelTest t;
+    size_t count = 0;
+
+    auto timer = t.Start(seconds(60), [&]() { ++count; });
+
+    REQUIRE(t.wheel.size() == 1);
+    REQUIRE(timer.expires_at() == t.epoch + seconds(60));
+
+    REQUIRE(timer.cancel());
+    REQUIRE(t.wheel.size() == 0);
+    REQUIRE_FALSE(t.armed);
+    REQUIRE(t.numDisarm == 1);
+
+    // the handle no longer refers to a timer
+    REQUIRE_FALSE(timer.cancel());
+
+    t.AdvanceTo(t.epoch + seconds(120));
+    REQUIRE(count == 0);
+}
+
+TEST_CASE(SUITE("EarlierTimerRearmsTheDriver"))
+{
+    TimerWheelTest t;
+
+    t.Start(seconds(60), []() {});
+    REQUIRE(t.armedAt <= t.epoch + seconds(60));
+    REQUIRE(t.numArm == 1);
+
+    t.Start(seconds(120), []() {});
+    REQUIRE(t.numArm == 1);
+
+    t.Start(seconds(5), []() {});
+    REQUIRE(t.armedAt <= t.epoch + seconds(5));
+    REQUIRE(t.numArm == 2);
+}
+
+TEST_CASE(SUITE("TimersAtEveryLevelExpireInOrder"))
+{
+    TimerWheelTest t;
+    std::vector<int> order;
+
+    // spans level 0 through 3 and the overflow list
+    t.Start(hours(10), [&]() { order.push_back(5); });
+    t.Start(hours(1), [&]() { order.push_back(4); });
+    t.Start(seconds(10), [&]() { order.push_back(3); });
+    t.Start(milliseconds(100), [&]() { order.push_back(2); });
+    t.Start(milliseconds(5), [&]() { order.push_back(1); });
+
+    t.AdvanceTo(t.epoch + hours(1) - milliseconds(1));
+    REQUIRE(order == std::vector<int>({1, 2, 3}));
+
+    t.AdvanceTo(t.epoch + hours(10) - milliseconds(1));
+    REQUIRE(order == std::vector<int>({1, 2, 3, 4}));
+
+    t.AdvanceTo(t.epoch + hours(10));
+    REQUIRE(order == std::vector<int>({1, 2, 3, 4, 5}));
+    REQUIRE(t.wheel.size() == 0);
+
+    // each timer costs at most one wake up per level it passes through
+    REQUIRE(t.numArm <= 5 * 5);
+}
+
+TEST_CASE(SUITE("ActionCanStartATimerThatIsAlreadyDue"))
+{
+    TimerWheelTest t;
+    size_t count = 0;
+
+    t.Start(milliseconds(10), [&]() {
+        ++count;
+        t.Start(milliseconds(0), [&]() { ++count; });
+    });
+
+    // the timer started by the action waits for the next pass of the driver, which is armed right away
+    REQUIRE(t.FireDriver());
+    REQUIRE(count == 1);
+    REQUIRE(t.wheel.size() == 1);
+    REQUIRE(t.armedAt <= t.now);
+
+    t.AdvanceTo(t.epoch + milliseconds(10));
+    REQUIRE(count == 2);
+    REQUIRE(t.wheel.size() == 0);
+}
+
+TEST_CASE(SUITE("ActionRestartingItselfAtNowRunsOncePerPass"))
+{
+    TimerWheelTest t;
+    size_t count = 0;
+
+    std::function<void()> restart = [&]() {
+        ++count;
+        t.Start(milliseconds(0), restart);
+    };
+
+    t.Start(milliseconds(10), restart);
+
+    for (size_t pass = 1; pass <= 3; ++pass)
+    {
+        REQUIRE(t.FireDriver());
+        REQUIRE(count == pass);
+        REQUIRE(t.wheel.size() == 1);
+        REQUIRE(t.now == t.epoch + milliseconds(10));
+    }
+}
+
+TEST_CASE(SUITE("TimersDueAtTheSameTickRunInTheOrderTheyWereStarted"))
+{
+    TimerWheelTest t;
+    std::vector<int> order;
+
+    // the first timers start in the higher levels and cascade down to the slot of the last ones
+    const auto expiration = t.epoch + hours(5);
+    t.Start(hours(5), [&]() { order.push_back(1); });
+    t.Start(hours(5), [&]() { order.push_back(2); });
+
+    t.AdvanceTo(t.epoch + hours(4));
+    t.Start(expiration - t.now, [&]() { order.push_back(3); });
+
+    t.AdvanceTo(expiration - seconds(30));
+    t.Start(expiration - t.now, [&]() { order.push_back(4); });
+
+    t.AdvanceTo(expiration - milliseconds(5));
+    t.Start(expiration - t.now, [&]() { order.push_back(5); });
+    t.Start(expiration - t.now, [&]() { order.push_back(6); });
+
+    t.AdvanceTo(expiration);
+    REQUIRE(order == std::vector<int>({1, 2, 3, 4, 5, 6}));
+    REQUIRE(t.wheel.size() == 0);
+}
+
+TEST_CASE(SUITE("ActionCanCancelAnotherTimerInTheSameSlot"))
+{
+    TimerWheelTest t;
+    size_t count = 0;
+
+    // the timers of a slot run in the order they were started
+    Timer other;
+    t.Start(milliseconds(10), [&]() { other.cancel(); });
+    other = t.Start(milliseconds(10), [&]() { ++count; });
+
+    t.AdvanceTo(t.epoch + milliseconds(10));
+    REQUIRE(t.wheel.size() == 0);
+    REQUIRE(count == 0);
+}
+
+TEST_CASE(SUITE("StaleWheelCatchesUpWhenEmpty"))
+{
+    TimerWheelTest t;
+    size_t count = 0;
+
+    t.now = t.epoch + hours(100);
+    t.Start(milliseconds(1), [&]() { ++count; });
+
+    REQUIRE(t.armedAt == t.now + milliseconds(1));
+
+    t.AdvanceTo(t.now + milliseconds(1));
+    REQUIRE(count == 1);
+}
+
+TEST_CASE(SUITE("RandomTimersExpireLikeAReferenceModel"))
+{
+    TimerWheelTest t;
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> delays(0, 20000000); // up to ~5.5 hours in ms
+
+    struct Record
+    {
+        steady_time_t expiration;
+        Timer timer;
+        bool canceled = false;
+        steady_time_t firedAt;
+        bool fired = false;
+    };
+
+    std::vector<Record> records(2000);
+
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        // start timers from different positions of the clock
+        if (i % 100 == 0)
+        {
+            t.AdvanceTo(t.now + milliseconds(delays(gen) / 1000));
+        }
+
+        auto& record = records[i];
+        const auto delay = milliseconds(delays(gen)) + microseconds(i % 1000);
+        record.expiration = t.now + delay;
+        record.timer = t.Start(delay, [&t, &record]() {
+            record.fired = true;
+            record.firedAt = t.now;
+        });
+    }
+
+    for (size_t i = 0; i < records.size(); i += 3)
+    {
+        if (!records[i].fired)
+        {
+            records[i].canceled = records[i].timer.cancel();
+        }
+    }
+
+    while (t.FireDriver())
+    {
+    }
+
+    REQUIRE(t.wheel.size() == 0);
+
+    for (const auto& record : records)
+    {
+        REQUIRE(record.fired != record.canceled);
+        if (record.fired)
+        {
+            REQUIRE(record.firedAt >= record.expiration);
+            REQUIRE(record.firedAt < record.expiration + milliseconds(1));
+        }
+    }
+}
@@ -32,6 +32,24 @@ using namespace ser4cpp;
 
 #define SUITE(name) "TransportLayerTestSuite - " name
 
+namespace
+{
+// write a segment into the buffer provided by the transport layer the way the link parser does
+ser4cpp::rseq_t WriteInPlace(TransportTestObject& test, const std::string& hex)
+{
+    HexSequence hs(hex);
+    const auto dest = test.transport.GetSegmentBuffer(hs.Size());
+    REQUIRE(dest.length() == hs.Size());
+    memcpy(dest, hs, hs.Size());
+    return ser4cpp::rseq_t(dest, hs.Size());
+}
+
+bool SendUpInPlace(TransportTestObject& test, const std::string& hex)
+{
+    return test.transport.OnReceive(Message(Addresses(), WriteInPlace(test, hex)));
+}
+} // namespace
+
 TEST_CASE(SUITE("RepeatSendsDoNotLogOrChangeStatistics"))
 {
     MockLogHandler log;
@@ -39,12 +57,12 @@ TEST_CASE(SUITE("RepeatSendsDoNotLogOrChangeStatistics"))
     HexSequence hs("12 34 56");
     tx.Configure(Message(Addresses(), hs.ToRSeq()));
 
-    auto segment1 = tx.GetSegment();
-    REQUIRE("C0 12 34 56" == HexConversions::to_hex(segment1));
+    REQUIRE(tx.GetHeader() == 0xC0);
+    REQUIRE("12 34 56" == HexConversions::to_hex(tx.GetPayload()));
     REQUIRE(tx.Statistics().numTransportTx == 1);
 
-    auto segment2 = tx.GetSegment();
-    REQUIRE("C0 12 34 56" == HexConversions::to_hex(segment2));
+    REQUIRE(tx.GetHeader() == 0xC0);
+    REQUIRE("12 34 56" == HexConversions::to_hex(tx.GetPayload()));
     REQUIRE(tx.Statistics().numTransportTx == 1);
 }
 
@@ -169,6 +187,70 @@ TEST_CASE(SUITE("ReceiveNewFir"))
     REQUIRE(test.transport.GetStatistics().rx.numTransportDiscard == 1);
 }
 
+TEST_CASE(SUITE("ReceiveLargestPossibleAPDUInPlace"))
+{
+    TransportTestObject test(true);
+
+    uint32_t num_packets = CalcMaxPackets(opendnp3::DEFAULT_MAX_APDU_SIZE, MAX_TPDU_PAYLOAD);
+    uint32_t last_packet_length = CalcLastPacketSize(opendnp3::DEFAULT_MAX_APDU_SIZE, MAX_TPDU_PAYLOAD);
+
+    std::vector<std::string> packets;
+    const auto apdu = test.GeneratePacketSequence(packets, num_packets, last_packet_length);
+    for (const auto& s : packets)
+    {
+        REQUIRE(SendUpInPlace(test, s));
+    }
+
+    REQUIRE(test.upper.received.AsHex() == apdu);
+}
+
+TEST_CASE(SUITE("InPlaceSegmentsCanBeMixedWithCopiedSegments"))
+{
+    TransportTestObject test(true);
+    SendUpInPlace(test, "40 0A 0B 0C"); // FIR/_/0
+    test.link.SendUp("01 0D 0E");       // _/_/1
+    SendUpInPlace(test, "82 0F");       // _/FIN/2
+    REQUIRE(test.upper.received.AsHex() == "0A 0B 0C 0D 0E 0F");
+}
+
+TEST_CASE(SUITE("UndeliveredInPlaceSegmentsDoNotCorruptTheFragment"))
+{
+    TransportTestObject test(true);
+    SendUpInPlace(test, "40 0A 0B 0C"); // FIR/_/0
+
+    // the link layer may drop a frame after it was written, e.g. a repeated FCB
+    WriteInPlace(test, "01 FF FF");
+    WriteInPlace(test, "01 EE");
+
+    // or the transport layer may drop it
+    SendUpInPlace(test, "03 DD DD"); // _/_/3
+    REQUIRE(test.transport.GetStatistics().rx.numTransportIgnore == 1);
+
+    test.link.SendUp("81 0D"); // _/FIN/1
+    REQUIRE(test.upper.received.AsHex() == "0A 0B 0C 0D");
+}
+
+TEST_CASE(SUITE("ReceiveNewFirInPlace"))
+{
+    TransportTestObject test(true);
+
+    SendUpInPlace(test, test.GetData("40")); // FIR/_/0
+    REQUIRE(test.upper.received.IsEmpty());
+
+    SendUpInPlace(test, "C0 AB CD"); // FIR/FIN/0
+    REQUIRE(test.upper.received.AsHex() == "AB CD");
+    REQUIRE(test.transport.GetStatistics().rx.numTransportDiscard == 1);
+}
+
+TEST_CASE(SUITE("NoSegmentBufferIfThePayloadWouldOverflow"))
+{
+    TransportTestObject test(true, 4); // maximum ASDU size of 4
+
+    SendUpInPlace(test, "40 11 22 33"); // FIR/_/0
+    REQUIRE(test.transport.GetSegmentBuffer(3).length() == 0);
+    REQUIRE(test.transport.GetSegmentBuffer(2).length() == 2);
+}
+
 TEST_CASE(SUITE("StateSending"))
 {
     TransportTestObject test(true);
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <catch.hpp>
+#include <outstation/event/TypedEventPool.h>
+
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "TypedEventPool - " name
+
+TEST_CASE(SUITE("CorrectInitialState"))
+{
+    TypedEventPool<int> pool(3);
+
+    REQUIRE(pool.Capacity() == 3);
+    REQUIRE(pool.Size() == 0);
+    REQUIRE_FALSE(pool.IsFullAndCapacityNotZero());
+}
+
+TEST_CASE(SUITE("AddsUntilFull"))
+{
+    TypedEventPool<int> pool(3);
+
+    const auto one = pool.Add(1);
+    const auto two = pool.Add(2);
+    const auto three = pool.Add(3);
+
+    REQUIRE(pool.IsFullAndCapacityNotZero());
+    REQUIRE(pool.Size() == 3);
+
+    REQUIRE(pool[one] == 1);
+    REQUIRE(pool[two] == 2);
+    REQUIRE(pool[three] == 3);
+}
+
+TEST_CASE(SUITE("IsFullAndCapacityNotZero for pool of capacity 0 return false"))
+{
+    TypedEventPool<int> pool(0);
+
+    REQUIRE_FALSE(pool.IsFullAndCapacityNotZero());
+}
+
+TEST_CASE(SUITE("RemovedSlotsAreReused"))
+{
+    TypedEventPool<int> pool(3);
+
+    pool.Add(1);
+    const auto two = pool.Add(2);
+    pool.Add(3);
+
+    pool.Remove(two);
+    REQUIRE_FALSE(pool.IsFullAndCapacityNotZero());
+    REQUIRE(pool.Size() == 2);
+
+    REQUIRE(pool.Add(4) == two);
+    REQUIRE(pool[two] == 4);
+    REQUIRE(pool.IsFullAndCapacityNotZero());
+}
+
+TEST_CASE(SUITE("PositionsAreIndexedInInsertionOrderAndRemovedEntriesAreDiscarded"))
+{
+    TypedEventPool<int> pool(2);
+    std::vector<bool> removed(10, false);
+    const auto is_removed = [&](uint32_t position) { return removed[position]; };
+
+    for (uint32_t position = 0; position < 4; ++position)
+    {
+        pool.AddPosition(position, is_removed);
+    }
+
+    removed[0] = removed[1] = removed[3] = true;
+    pool.SkipPositions(is_removed);
+    REQUIRE(pool.NumPositions() == 2);
+    REQUIRE(pool.Position(0) == 2);
+
+    // the index is full, so the removed entries are discarded before appending
+    pool.AddPosition(7, is_removed);
+    REQUIRE(pool.NumPositions() == 2);
+    REQUIRE(pool.Position(0) == 2);
+    REQUIRE(pool.Position(1) == 7);
+}
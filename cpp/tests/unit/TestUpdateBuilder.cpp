@@ -21,6 +21,8 @@
 
 #include <catch.hpp>
 
+#include <string>
+
 using namespace opendnp3;
 
 #define SUITE(name) "UpdateBuilderTestSuite - " name
@@ -40,3 +42,90 @@ TEST_CASE(SUITE("builder is cleared after building"))
         REQUIRE(updates.IsEmpty());
     }
 }
+
+TEST_CASE(SUITE("batch applies updates in the order they were recorded"))
+{
+    struct Recorder : public IUpdateHandler
+    {
+        std::string calls;
+
+        bool Update(const Binary&, uint16_t index, EventMode) override
+        {
+            return this->Record("b", index);
+        }
+        bool Update(const DoubleBitBinary&, uint16_t index, EventMode) override
+        {
+            return this->Record("d", index);
+        }
+        bool Update(const Analog&, uint16_t index, EventMode) override
+        {
+            return this->Record("a", index);
+        }
+        bool Update(const Counter&, uint16_t index, EventMode) override
+        {
+            return this->Record("c", index);
+        }
+        bool FreezeCounter(uint16_t index, bool, EventMode) override
+        {
+            return this->Record("f", index);
+        }
+        bool Update(const BinaryOutputStatus&, uint16_t index, EventMode) override
+        {
+            return this->Record("bo", index);
+        }
+        bool Update(const AnalogOutputStatus&, uint16_t index, EventMode) override
+        {
+            return this->Record("ao", index);
+        }
+        bool Update(const OctetString&, uint16_t index, EventMode) override
+        {
+            return this->Record("o", index);
+        }
+        bool Update(const TimeAndInterval&, uint16_t index) override
+        {
+            return this->Record("t", index);
+        }
+        bool Modify(FlagsType, uint16_t start, uint16_t, uint8_t) override
+        {
+            return this->Record("m", start);
+        }
+
+        bool Record(const char* type, uint16_t index)
+        {
+            calls += type + std::to_string(index) + " ";
+            return true;
+        }
+    };
+
+    UpdateBatch batch;
+    batch.Update(Analog(1.0), 0);
+    batch.Update(Analog(2.0), 1);
+    batch.Update(Counter(3), 2);
+    batch.FreezeCounter(2);
+    batch.Update(Analog(4.0), 3);
+    batch.Modify(FlagsType::AnalogInput, 4, 5, 0x01);
+
+    REQUIRE(batch.Size() == 6);
+
+    Recorder recorder;
+    batch.Apply(recorder);
+    REQUIRE(recorder.calls == "a0 a1 c2 f2 a3 m4 ");
+}
+
+TEST_CASE(SUITE("batch can be cleared and reused"))
+{
+    UpdateBatch batch;
+    batch.Reserve<UpdateBatch::Record<Analog>>(10);
+    batch.Update(Analog(1.0), 0);
+    REQUIRE_FALSE(batch.IsEmpty());
+
+    batch.Clear();
+    REQUIRE(batch.IsEmpty());
+    REQUIRE(batch.Size() == 0);
+
+    batch.Update(Binary(true), 0);
+    REQUIRE(batch.Size() == 1);
+
+    const Updates updates(std::move(batch));
+    REQUIRE_FALSE(updates.IsEmpty());
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2013-2022 Step Function I/O, LLC
+ *
+ * Licensed to Green Energy Corp (www.greenenergycorp.com) and Step Function I/O
+ * LLC (https://stepfunc.io) under one or more contributor license agreements.
+ * See the NOTICE file distributed with this work for additional information
+ * regarding copyright ownership. Green Energy Corp and Step Function I/O LLC license
+ * this file to you under the Apache License, Version 2.0 (the "License"); you
+ * may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/OutstationTestObject.h"
+
+#include <opendnp3/outstation/UpdateBuilder.h>
+
+#include <dnp3mocks/DatabaseHelpers.h>
+
+#include <catch.hpp>
+#include <outstation/UpdateQueue.h>
+
+#include <thread>
+#include <vector>
+
+using namespace opendnp3;
+
+#define SUITE(name) "UpdateQueue - " name
+
+Updates counter_update(uint32_t value, uint16_t index)
+{
+    UpdateBuilder builder;
+    builder.Update(Counter(value), index);
+    return builder.Build();
+}
+
+TEST_CASE(SUITE("capacity is rounded up to a power of two"))
+{
+    UpdateQueue queue(5);
+    REQUIRE(queue.Capacity() == 8);
+
+    UpdateQueue single(1);
+    REQUIRE(single.Capacity() == 2);
+}
+
+TEST_CASE(SUITE("push fails when full and succeeds again after draining"))
+{
+    UpdateQueue queue(2);
+
+    REQUIRE(queue.TryPush(counter_update(1, 0)));
+    REQUIRE(queue.TryPush(counter_update(2, 1)));
+    REQUIRE_FALSE(queue.TryPush(counter_update(3, 2)));
+
+    std::vector<size_t> sizes;
+    REQUIRE(queue.Drain([&](const Updates& updates) { sizes.push_back(updates.GetBatch()->Size()); }) == 2);
+    REQUIRE(sizes.size() == 2);
+
+    // wrap around the ring a few times
+    for (int i = 0; i < 5; ++i)
+    {
+        REQUIRE(queue.TryPush(counter_update(4, 3)));
+        REQUIRE(queue.Drain([](const Updates&) {}) == 1);
+    }
+
+    REQUIRE(queue.Drain([](const Updates&) {}) == 0);
+}
+
+TEST_CASE(SUITE("only one drain is requested until the queue is drained"))
+{
+    UpdateQueue queue(4);
+
+    REQUIRE(queue.TryPush(counter_update(1, 0)));
+    REQUIRE(queue.RequestDrain());
+    REQUIRE(queue.TryPush(counter_update(2, 0)));
+    REQUIRE_FALSE(queue.RequestDrain());
+
+    REQUIRE(queue.Drain([](const Updates&) {}) == 2);
+    REQUIRE(queue.RequestDrain());
+}
+
+Updates counter_updates(size_t count)
+{
+    UpdateBuilder builder;
+    for (size_t i = 0; i < count; ++i)
+    {
+        builder.Update(Counter(static_cast<uint32_t>(i)), static_cast<uint16_t>(i));
+    }
+    return builder.Build();
+}
+
+TEST_CASE(SUITE("overflowed updates are consumed in the order they were pushed"))
+{
+    UpdateQueue queue(2);
+
+    // each set of updates is identified by its size
+    queue.Push(counter_updates(1));
+    queue.Push(counter_updates(2));
+    queue.Push(counter_updates(3));
+    REQUIRE_FALSE(queue.TryPush(counter_updates(5)));
+
+    std::vector<size_t> sizes;
+    const auto consumed = queue.Drain([&](const Updates& updates) {
+        const auto size = updates.GetBatch()->Size();
+        if (size == 1)
+        {
+            // the ring has room again, but these must still go behind the overflowed updates
+            REQUIRE_FALSE(queue.TryPush(counter_updates(5)));
+            queue.Push(counter_updates(4));
+        }
+        sizes.push_back(size);
+    });
+
+    REQUIRE(consumed == 4);
+    REQUIRE(sizes == std::vector<size_t>{1, 2, 3, 4});
+
+    // with the overflow consumed, pushes go back to the ring
+    REQUIRE(queue.TryPush(counter_updates(1)));
+    REQUIRE(queue.Drain([](const Updates&) {}) == 1);
+}
+
+TEST_CASE(SUITE("the last update pushed by a producer is the one left in the database"))
+{
+    auto database = configure::by_count_of::counter(1);
+    database.counter[0].svariation = StaticCounterVariation::Group20Var1;
+    OutstationTestObject t(OutstationConfig(), std::move(database));
+    t.LowerLayerUp();
+
+    UpdateQueue queue(2);
+
+    queue.Push(counter_update(1, 0));
+    queue.Push(counter_update(2, 0));
+    queue.Push(counter_update(3, 0)); // the ring is full, so this overflows
+
+    bool first = true;
+    queue.Drain([&](const Updates& updates) {
+        if (first)
+        {
+            // the ring has room again, but this must still be applied after the overflowed update
+            queue.Push(counter_update(4, 0));
+            first = false;
+        }
+        t.context.ApplyUpdates(*updates.GetBatch());
+    });
+
+    t.SendToOutstation("C0 01 3C 01 06"); // Read class 0
+    REQUIRE(t.lower->PopWriteAsHex() == "C0 81 80 00 14 01 00 00 00 01 04 00 00 00");
+}
+
+TEST_CASE(SUITE("entries from multiple producers are all consumed"))
+{
+    const size_t num_producers = 4;
+    const size_t num_per_producer = 1000;
+
+    UpdateQueue queue(64);
+
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < num_producers; ++p)
+    {
+        producers.emplace_back([&queue, p]() {
+            for (size_t i = 0; i < num_per_producer; ++i)
+            {
+                const auto updates = counter_update(static_cast<uint32_t>(i), static_cast<uint16_t>(p));
+                while (!queue.TryPush(updates))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    size_t consumed = 0;
+    while (consumed < num_producers * num_per_producer)
+    {
+        consumed += queue.Drain([](const Updates&) {});
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    REQUIRE(consumed == num_producers * num_per_producer);
+}
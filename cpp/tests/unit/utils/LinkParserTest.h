@@ -35,7 +35,10 @@
 class LinkParserTest
 {
 public:
-    LinkParserTest(bool aImmediate = false) : log(), sink(), parser(log.logger) {}
+    LinkParserTest(bool aImmediate = false, size_t bufferSize = opendnp3::LINK_DEFAULT_RX_BUFFER_SIZE)
+        : log(), sink(), parser(log.logger, bufferSize)
+    {
+    }
 
     void WriteData(const ser4cpp::rseq_t& input)
     {
@@ -47,11 +47,15 @@ bool MockTransportSegment::HasValue() const
     return remainder.length() > 0;
 }
 
-ser4cpp::rseq_t MockTransportSegment::GetSegment()
+uint8_t MockTransportSegment::GetHeader()
+{
+    return remainder[0];
+}
+
+ser4cpp::rseq_t MockTransportSegment::GetPayload()
 {
     auto size = std::min(segmentSize, remainder.length());
-    auto chunk = remainder.take(size);
-    return chunk;
+    return remainder.take(size).skip(1);
 }
 
 bool MockTransportSegment::Advance()
@@ -38,7 +38,9 @@ public:
 
     bool HasValue() const override;
 
-    ser4cpp::rseq_t GetSegment() override;
+    uint8_t GetHeader() override;
+
+    ser4cpp::rseq_t GetPayload() override;
 
     bool Advance() override;
 